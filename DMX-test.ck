@@ -137,6 +137,85 @@ fun void runTests(DMX dmx) {
     dmx.send();
     "DMX Test" => dmx.name;
     100 => dmx.priority;
+
+    // --- Test 11: Async output ---
+    waitForKey("Test 11: Async output fade (2s)");
+    1 => dmx.async;
+    44.0 => dmx.refreshRate;
+    <<< "  Async:", dmx.async(), "refresh:", dmx.refreshRate() >>>;
+    for (int i; i < NUM * CH; i++) {
+        dmx.fade(1 + i, 255, 2000);
+    }
+    now => time ta;
+    while (now < ta + 2500::ms) {
+        dmx.send();
+        23::ms => now;
+    }
+    dmx.blackout();
+    dmx.send();
+    100::ms => now;
+    0 => dmx.async;
+
+    // --- Test 12: Whole-universe crossfade ---
+    waitForKey("Test 12: Crossfade universe 1 to full (2s)");
+    int look[512];
+    for (int i; i < NUM * CH; i++) 255 => look[i];
+    dmx.crossfade(1, look, 2000);
+    now => time tx;
+    while (now < tx + 2500::ms) {
+        dmx.send();
+        23::ms => now;
+    }
+    dmx.blackout();
+    dmx.send();
+
+    // --- Test 13: DMXOut ---
+    waitForKey("Test 13: DMXOut pulsing channel 1 from a 1 Hz LFO (3s)");
+    SinOsc lfo => DMXOut dout => blackhole;
+    1 => lfo.freq;
+    dout.dmx(dmx);
+    dout.map(0, 1, 1);
+    DMXOut.PEAK => dout.mode;
+    now => time td;
+    while (now < td + 3::second) {
+        dmx.send();
+        23::ms => now;
+    }
+    lfo =< dout;
+    dout.unmap(0);
+    dmx.blackout();
+    dmx.send();
+
+    // --- Test 14: ChucK-time clock and sendAt ---
+    waitForKey("Test 14: Scheduled frames on the beat (dark, then 4 x 500ms red/blue)");
+    DMX.CLOCK_CHUCK => dmx.clock;
+    dmx.blackout();
+    dmx.send();
+    for (int beat; beat < 4; beat++) {
+        setAll(dmx, beat % 2 * 255, 0, (beat + 1) % 2 * 255, 0, 0);
+        dmx.sendAt(now + (beat + 1) * 500::ms);
+    }
+    // send() only drains due frames; the queued looks aren't published early
+    <<< "  Scheduled:", dmx.scheduled(), "(fixtures stay dark until the first beat)" >>>;
+    now => time ts;
+    while (now < ts + 2100::ms) {
+        dmx.send();
+        10::ms => now;
+    }
+    <<< "  Still scheduled:", dmx.scheduled() >>>;
+
+    // --- Test 15: Cancelled sendAt ---
+    waitForKey("Test 15: Cancelled schedule, then all green on send()");
+    setAll(dmx, 0, 255, 0, 0, 0);
+    dmx.sendAt(now + 10::second);
+    dmx.clearScheduled();
+    // The cancelled frame's changes are published by the next send()
+    dmx.send();
+    <<< "  Scheduled:", dmx.scheduled(), "(fixtures should be green now)" >>>;
+    1::second => now;
+    DMX.CLOCK_SYSTEM => dmx.clock;
+    dmx.blackout();
+    dmx.send();
 }
 
 // Protocol names and constants
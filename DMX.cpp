@@ -13,13 +13,31 @@
 #include <cstring>
 #include <cmath>
 #include <mutex>
-#include <map>
+#include <atomic>
+#include <condition_variable>
+#include <thread>
+#include <memory>
+#include <algorithm>
 #include <vector>
+#include <functional>
 
 extern "C" {
 #include "artnet/artnet.h"
 }
 
+// Crossfade kernel instruction set, chosen at compile time (AVX2 only when the
+// compiler targets it, e.g. -mavx2 or /arch:AVX2)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define DMX_BLEND_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define DMX_BLEND_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#define DMX_BLEND_NEON 1
+#endif
+
 #ifdef _WIN32
 #include <windows.h>
 static void dmx_usleep(unsigned int us) {
@@ -36,13 +54,189 @@ static void dmx_usleep(unsigned int us) {
 }
 #else
 #include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <sys/ioctl.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <cerrno>
+#if defined(__linux__)
+#include <sys/prctl.h>
+#include <sys/inotify.h>
+#endif
 static void dmx_usleep(unsigned int us) { usleep(us); }
 #endif
 
+// Sleeps until `deadline` to within a few microseconds. usleep() and friends
+// routinely overshoot by 50-1000 us, so the OS sleep stops DMX_SPIN_US short
+// and the rest is spun.
+static constexpr int DMX_SPIN_US = 60;
+static void dmx_sleep_until(std::chrono::steady_clock::time_point deadline) {
+    auto coarse = deadline - std::chrono::microseconds(DMX_SPIN_US);
+#if defined(__linux__)
+    // steady_clock is CLOCK_MONOTONIC, so an absolute wait cannot drift
+    if (coarse > std::chrono::steady_clock::now()) {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(coarse.time_since_epoch()).count();
+        timespec ts{ static_cast<time_t>(ns / 1000000000), static_cast<long>(ns % 1000000000) };
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+    }
+#elif !defined(_WIN32)
+    std::this_thread::sleep_until(coarse);
+#endif
+    // Windows sleeps are millisecond-grained, so it spins the whole wait (as dmx_usleep does)
+    while (std::chrono::steady_clock::now() < deadline) {}
+}
+
+// Arbitrary serial rates via termios2/BOTHER. struct termios2 lives in
+// <asm/termbits.h>, which clashes with glibc's <termios.h>, so the
+// asm-generic layout that TCGETS2/TCSETS2 expect is mirrored here.
+#if defined(__linux__) && defined(TCGETS2) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__) || defined(__riscv))
+#define DMX_HAVE_TERMIOS2 1
+#ifndef BOTHER
+#define BOTHER 0010000
+#endif
+struct termios2 {
+    tcflag_t c_iflag;
+    tcflag_t c_oflag;
+    tcflag_t c_cflag;
+    tcflag_t c_lflag;
+    cc_t c_line;
+    cc_t c_cc[19];
+    speed_t c_ispeed;
+    speed_t c_ospeed;
+};
+
+// Sets input and output speed to `baud`; `drain` waits for queued output first
+static bool dmx_set_baud(int fd, uint32_t baud, bool drain) {
+    termios2 tio;
+    if (ioctl(fd, TCGETS2, &tio) < 0) return false;
+    tio.c_cflag &= ~(CBAUD | (CBAUD << 16)); // output and input speed fields
+    tio.c_cflag |= BOTHER | (BOTHER << 16);
+    tio.c_ispeed = baud;
+    tio.c_ospeed = baud;
+    return ioctl(fd, drain ? TCSETSW2 : TCSETS2, &tio) == 0;
+}
+#endif
+
 static inline int clamp_dmx(int val) {
     return val < 0 ? 0 : (val > 255 ? 255 : val);
 }
 
+// Clamp n ChucK ints to 0-255 bytes. Branchless so the compiler vectorizes it.
+static void clamp_copy_dmx(const t_CKINT* in, unsigned char* out, int n) {
+    for (int i = 0; i < n; i++) {
+        t_CKINT v = in[i];
+        v = v < 0 ? 0 : v;
+        v = v > 255 ? 255 : v;
+        out[i] = static_cast<unsigned char>(v);
+    }
+}
+
+// out[i] = (from[i] * (256 - w) + to[i] * w + 128) >> 8 for a weight w in 0..256.
+// Every intermediate fits in 16 bits, so the vector paths work on u16 lanes.
+static void blend_frame_scalar(const uint8_t* from, const uint8_t* to, uint8_t* out, int n, unsigned w) {
+    const unsigned iw = 256 - w;
+    for (int i = 0; i < n; i++)
+        out[i] = static_cast<uint8_t>((from[i] * iw + to[i] * w + 128) >> 8);
+}
+
+static void blend_frame(const uint8_t* from, const uint8_t* to, uint8_t* out, int n, unsigned w) {
+    int i = 0;
+#if defined(DMX_BLEND_AVX2)
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i vw = _mm256_set1_epi16(static_cast<short>(w));
+    const __m256i viw = _mm256_set1_epi16(static_cast<short>(256 - w));
+    const __m256i round = _mm256_set1_epi16(128);
+    for (; i + 32 <= n; i += 32) {
+        __m256i f = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(from + i));
+        __m256i t = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(to + i));
+        // unpack/pack both work per 128-bit lane, so byte order is preserved
+        __m256i lo = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(f, zero), viw),
+                                      _mm256_mullo_epi16(_mm256_unpacklo_epi8(t, zero), vw));
+        __m256i hi = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(f, zero), viw),
+                                      _mm256_mullo_epi16(_mm256_unpackhi_epi8(t, zero), vw));
+        lo = _mm256_srli_epi16(_mm256_add_epi16(lo, round), 8);
+        hi = _mm256_srli_epi16(_mm256_add_epi16(hi, round), 8);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_packus_epi16(lo, hi));
+    }
+#elif defined(DMX_BLEND_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i vw = _mm_set1_epi16(static_cast<short>(w));
+    const __m128i viw = _mm_set1_epi16(static_cast<short>(256 - w));
+    const __m128i round = _mm_set1_epi16(128);
+    for (; i + 16 <= n; i += 16) {
+        __m128i f = _mm_loadu_si128(reinterpret_cast<const __m128i*>(from + i));
+        __m128i t = _mm_loadu_si128(reinterpret_cast<const __m128i*>(to + i));
+        __m128i lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(f, zero), viw),
+                                   _mm_mullo_epi16(_mm_unpacklo_epi8(t, zero), vw));
+        __m128i hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(f, zero), viw),
+                                   _mm_mullo_epi16(_mm_unpackhi_epi8(t, zero), vw));
+        lo = _mm_srli_epi16(_mm_add_epi16(lo, round), 8);
+        hi = _mm_srli_epi16(_mm_add_epi16(hi, round), 8);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(lo, hi));
+    }
+#elif defined(DMX_BLEND_NEON)
+    const uint16_t w16 = static_cast<uint16_t>(w);
+    const uint16_t iw16 = static_cast<uint16_t>(256 - w);
+    for (; i + 16 <= n; i += 16) {
+        uint8x16_t f = vld1q_u8(from + i);
+        uint8x16_t t = vld1q_u8(to + i);
+        uint16x8_t lo = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_low_u8(f)), iw16), vmovl_u8(vget_low_u8(t)), w16);
+        uint16x8_t hi = vmlaq_n_u16(vmulq_n_u16(vmovl_u8(vget_high_u8(f)), iw16), vmovl_u8(vget_high_u8(t)), w16);
+        // vrshrn adds the 128 rounding bias before narrowing
+        vst1q_u8(out + i, vcombine_u8(vrshrn_n_u16(lo, 8), vrshrn_n_u16(hi, 8)));
+    }
+#endif
+    if (i < n) blend_frame_scalar(from + i, to + i, out + i, n - i, w);
+}
+
+// Single-producer/single-consumer triple buffer. The writer fills back() and
+// publish()es it; the reader acquire()s the newest published buffer into
+// front(). Neither side ever blocks or waits on the other, and the reader
+// always sees a complete frame.
+template <typename T>
+class TripleBuffer {
+public:
+    TripleBuffer() = default;
+    // Moving is only valid while neither side is active (e.g., arena growth under send_mutex)
+    TripleBuffer(TripleBuffer&& other) noexcept
+        : _back(other._back), _middle(other._middle.load()), _front(other._front) {
+        memcpy(_bufs, other._bufs, sizeof(_bufs));
+    }
+    TripleBuffer& operator=(TripleBuffer&& other) noexcept {
+        memcpy(_bufs, other._bufs, sizeof(_bufs));
+        _back = other._back;
+        _middle.store(other._middle.load());
+        _front = other._front;
+        return *this;
+    }
+
+    // Writer side
+    T& back() { return _bufs[_back]; }
+    void publish() {
+        _back = _middle.exchange(static_cast<uint8_t>(_back | FRESH), std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Reader side; returns true if a newer frame was swapped into front()
+    bool acquire() {
+        if (!(_middle.load(std::memory_order_acquire) & FRESH)) return false;
+        _front = _middle.exchange(_front, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+    const T& front() const { return _bufs[_front]; }
+    T& front() { return _bufs[_front]; }   // reader may patch its own buffer
+
+private:
+    static constexpr uint8_t INDEX = 0x03;
+    static constexpr uint8_t FRESH = 0x04;
+    T _bufs[3]{};
+    uint8_t _back{ 0 };
+    std::atomic<uint8_t> _middle{ 1 };
+    uint8_t _front{ 2 };
+};
+
 CK_DLL_CTOR(dmx_ctor);
 CK_DLL_DTOR(dmx_dtor);
 
@@ -52,17 +246,58 @@ CK_DLL_MFUN(dmx_get_channel);
 CK_DLL_MFUN(dmx_channel);
 CK_DLL_MFUN(dmx_channel_uni);
 CK_DLL_MFUN(dmx_channels);
+CK_DLL_MFUN(dmx_frame);
+CK_DLL_MFUN(dmx_get_frame);
 
 CK_DLL_MFUN(dmx_init);
 CK_DLL_MFUN(dmx_send);
 CK_DLL_MFUN(dmx_blackout);
 CK_DLL_MFUN(dmx_connected);
 CK_DLL_MFUN(dmx_debug);
+CK_DLL_MFUN(dmx_allocations);
+
+// async output
+CK_DLL_MFUN(dmx_get_async);
+CK_DLL_MFUN(dmx_async);
+CK_DLL_MFUN(dmx_get_refresh_rate);
+CK_DLL_MFUN(dmx_refresh_rate);
+CK_DLL_MFUN(dmx_get_min_slots);
+CK_DLL_MFUN(dmx_min_slots);
+CK_DLL_MFUN(dmx_get_break_mode);
+CK_DLL_MFUN(dmx_break_mode);
+CK_DLL_MFUN(dmx_get_pacing);
+CK_DLL_MFUN(dmx_get_pacing_gap);
+CK_DLL_MFUN(dmx_pacing);
+CK_DLL_MFUN(dmx_paced_rate);
+CK_DLL_MFUN(dmx_pacing_jitter);
+
+// ChucK-time scheduling
+CK_DLL_MFUN(dmx_send_at);
+CK_DLL_MFUN(dmx_scheduled);
+CK_DLL_MFUN(dmx_clear_scheduled);
+CK_DLL_MFUN(dmx_get_clock);
+CK_DLL_MFUN(dmx_clock);
 
 // serial
 CK_DLL_MFUN(dmx_get_port);
 CK_DLL_MFUN(dmx_port);
+CK_DLL_MFUN(dmx_get_universe_port);
+CK_DLL_MFUN(dmx_universe_port);
+CK_DLL_MFUN(dmx_universe_port_output);
+CK_DLL_MFUN(dmx_widget_params);
+CK_DLL_MFUN(dmx_get_port2_label);
+CK_DLL_MFUN(dmx_port2_label);
 CK_DLL_SFUN(dmx_list_ports);
+CK_DLL_MFUN(dmx_ports_event);
+
+// Serial input
+CK_DLL_MFUN(dmx_get_input);
+CK_DLL_MFUN(dmx_input);
+CK_DLL_MFUN(dmx_input_framing);
+CK_DLL_MFUN(dmx_input_channel);
+CK_DLL_MFUN(dmx_input_frame);
+CK_DLL_MFUN(dmx_input_count);
+CK_DLL_MFUN(dmx_input_event);
 
 // sACN and ArtNet
 CK_DLL_MFUN(dmx_get_universe);
@@ -76,6 +311,13 @@ CK_DLL_MFUN(dmx_universes);
 CK_DLL_MFUN(dmx_get_priority);
 CK_DLL_MFUN(dmx_priority);
 
+// ArtSync
+CK_DLL_MFUN(dmx_get_artnet_sync);
+CK_DLL_MFUN(dmx_artnet_sync);
+CK_DLL_MFUN(dmx_get_artnet_unicast);
+CK_DLL_MFUN(dmx_artnet_unicast);
+CK_DLL_MFUN(dmx_artnet_nodes);
+
 // source name
 CK_DLL_MFUN(dmx_get_name);
 CK_DLL_MFUN(dmx_name);
@@ -84,9 +326,23 @@ CK_DLL_MFUN(dmx_name);
 // fade
 CK_DLL_MFUN(dmx_fade);
 CK_DLL_MFUN(dmx_fade_uni);
+CK_DLL_MFUN(dmx_crossfade);
+CK_DLL_MFUN(dmx_crossfade_multi);
+
+// DMXOut UGen
+CK_DLL_CTOR(dmxout_ctor);
+CK_DLL_DTOR(dmxout_dtor);
+CK_DLL_TICKF(dmxout_tickf);
+CK_DLL_MFUN(dmxout_dmx);
+CK_DLL_MFUN(dmxout_map);
+CK_DLL_MFUN(dmxout_unmap);
+CK_DLL_MFUN(dmxout_get_mode);
+CK_DLL_MFUN(dmxout_mode);
 
 // internal data offset for C++ class pointer storage
 t_CKINT dmx_data_offset = 0;
+t_CKINT dmxout_data_offset = 0;
+t_CKINT dmxout_ref_offset = 0;   // bound DMX Chuck_Object*, held with a reference
 
 // static protocol constants exposed to ChucK
 static t_CKINT dmx_SERIAL_RAW = 0;
@@ -94,6 +350,19 @@ static t_CKINT dmx_SERIAL = 1;
 static t_CKINT dmx_SACN = 2;
 static t_CKINT dmx_ARTNET = 3;
 
+// fade clock constants exposed to ChucK
+static t_CKINT dmx_CLOCK_SYSTEM = 0;
+static t_CKINT dmx_CLOCK_CHUCK = 1;
+
+// raw serial break strategies exposed to ChucK
+static t_CKINT dmx_BREAK_IOCTL = 0;
+static t_CKINT dmx_BREAK_BAUD = 1;
+
+// DMXOut decimation modes exposed to ChucK
+static t_CKINT dmxout_PEAK = 0;
+static t_CKINT dmxout_MEAN = 1;
+static t_CKINT dmxout_LAST = 2;
+
 // sACN global init reference count (shared across all DMX instances)
 static std::mutex sacn_global_mutex;
 static int sacn_ref_count = 0;
@@ -117,52 +386,1177 @@ static void sacn_global_deinit() {
     }
 }
 
-class DMX {
+// Process-wide cache of serial port names. serial::list_ports() rescans /sys
+// (or the registry) on every call, so the list is kept here and refreshed
+// only when devices change: inotify on /dev on Linux, a periodic rescan
+// elsewhere. Subscribers run on the watcher thread after every change.
+class PortWatcher {
 public:
-    enum class Protocol { Serial_Raw, Serial, sACN, ArtNet };
+    static constexpr int POLL_MS = 250;        // stop latency of the watcher thread
+    static constexpr int SETTLE_MS = 100;      // let udev finish permissions and symlinks
+    static constexpr int RESCAN_MS = 2000;     // without inotify
+
+    static PortWatcher& instance() {
+        static PortWatcher watcher;
+        return watcher;
+    }
+
+    // Comma-separated port names, as ports() has always returned them
+    std::string ports() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _ports;
+    }
+
+    // Number of times the list has changed
+    uint64_t changes() const { return _changes.load(std::memory_order_relaxed); }
+
+    void subscribe(const void* key, std::function<void()> fn) {
+        std::lock_guard<std::mutex> lock(_subscriber_mutex);
+        _subscribers.emplace_back(key, std::move(fn));
+    }
+    // After this returns the callback is not running and will not run again
+    void unsubscribe(const void* key) {
+        std::lock_guard<std::mutex> lock(_subscriber_mutex);
+        _subscribers.erase(std::remove_if(_subscribers.begin(), _subscribers.end(),
+            [key](const std::pair<const void*, std::function<void()>>& s) { return s.first == key; }),
+            _subscribers.end());
+    }
+
+private:
+    std::mutex _mutex;                 // protects _ports
+    std::string _ports;
+    std::atomic<uint64_t> _changes{ 0 };
+    std::mutex _subscriber_mutex;
+    std::vector<std::pair<const void*, std::function<void()>>> _subscribers;
+    std::atomic<bool> _stop{ false };
+    std::thread _thread;
+
+    PortWatcher() {
+        _ports = scan();
+        _thread = std::thread(&PortWatcher::run, this);
+    }
+    ~PortWatcher() {
+        _stop = true;
+        if (_thread.joinable())
+            _thread.join();
+    }
+
+    static std::string scan() {
+        std::vector<serial::PortInfo> ports = serial::list_ports();
+        std::string result;
+        for (size_t i = 0; i < ports.size(); i++) {
+            if (i > 0) result += ",";
+            result += ports[i].port;
+        }
+        return result;
+    }
+
+    void rescan() {
+        std::string ports = scan();
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (ports == _ports) return;
+            _ports = ports;
+        }
+        _changes.fetch_add(1, std::memory_order_relaxed);
+        std::lock_guard<std::mutex> lock(_subscriber_mutex);
+        for (auto& s : _subscribers) s.second();
+    }
+
+    void sleep_ms(int ms) {
+        for (int slept = 0; slept < ms && !_stop; slept += 50)
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+
+    void run() {
+#if defined(__linux__)
+        int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd >= 0 && inotify_add_watch(fd, "/dev", IN_CREATE | IN_DELETE | IN_MOVED_TO | IN_MOVED_FROM) >= 0) {
+            alignas(inotify_event) char buf[4096];
+            while (!_stop) {
+                pollfd pfd{ fd, POLLIN, 0 };
+                if (poll(&pfd, 1, POLL_MS) <= 0) continue;
+                sleep_ms(SETTLE_MS);
+                while (read(fd, buf, sizeof(buf)) > 0) {} // coalesce the burst
+                rescan();
+            }
+            close(fd);
+            return;
+        }
+        if (fd >= 0) close(fd);
+#endif
+        while (!_stop) {
+            sleep_ms(RESCAN_MS);
+            if (!_stop) rescan();
+        }
+    }
+};
+
+// Opens `port` at the DMX512 line settings (250 kbaud, 8N2, no flow control)
+static void open_dmx_port(serial::Serial& s, const std::string& port, uint32_t timeout_ms) {
+    if (s.isOpen())
+        s.close();
+    s.setPort(port);
+    s.setBaudrate(250000);
+    s.setBytesize(serial::eightbits);
+    s.setParity(serial::parity_none);
+    s.setStopbits(serial::stopbits_two);
+    s.setFlowcontrol(serial::flowcontrol_none);
+    serial::Timeout timeout = serial::Timeout::simpleTimeout(timeout_ms);
+    s.setTimeout(timeout);
+    s.open();
+}
+
+// Serial DMX output for one port, driven by its own writer thread. submit()
+// only replaces the pending frame and returns, and the thread always writes the
+// newest frame, so a slow or backed-up adapter drops stale frames instead of
+// queueing them or stalling the caller. Frames live in Enttec-formatted
+// message buffers that rotate between submitter and writer, so a frame is
+// copied once on submit and written in place (writev on POSIX). The port's
+// non-blocking fd is written directly and TIOCOUTQ keeps at most one frame
+// in the kernel queue.
+// Enttec framing can carry a second universe (Pro Mk2 output 2) and widget
+// parameter messages on the same link. An optional pacer starts frames on a
+// fixed-rate grid instead of whenever frames are submitted.
+class SerialWriter {
+public:
+    enum class Framing { Raw, Enttec };
+    // How the raw framing generates the break before each frame:
+    // Ioctl holds TIOCSBRK for BREAK_US, timed by dmx_sleep_until();
+    // Baud sends one 0x00 byte at BREAK_BAUDRATE, so the UART times the
+    // break and its stop bits form the Mark After Break (Linux termios2 only)
+    enum class BreakMode { Ioctl, Baud };
+
+    // Achieved break/MAB timing of raw frames, measured on the writer thread
+    struct BreakTiming {
+        uint64_t frames{ 0 };
+        double break_us_total{ 0 };
+        double break_us_max{ 0 };
+        double mab_us_total{ 0 };
+        double mab_us_max{ 0 };
+    };
+
+    // Widget output timing, in the device's units (Enttec label 4)
+    struct WidgetParams {
+        uint8_t break_time;   // 10.67 us units, 9-127
+        uint8_t mab_time;     // 10.67 us units, 1-127
+        uint8_t rate;         // packets per second, 1-40; 0 = as fast as possible
+    };
+
+    // Frame pacing. With rate_hz > 0 a frame starts on every tick of an
+    // absolute-deadline grid, carrying the newest submitted frames (repeated
+    // if nothing new arrived); min_gap_us keeps frame starts apart either way.
+    struct Pacing {
+        double rate_hz;       // 0 = unpaced: write as soon as a frame is submitted
+        int min_gap_us;       // 0 = no minimum
+    };
+
+    // Achieved pacing over the last completed PACING_WINDOW_MS window
+    struct PacingStats {
+        double rate_hz{ 0 };           // frames started per second
+        double jitter_us{ 0 };         // mean lateness of paced frame starts
+        double jitter_max_us{ 0 };
+        uint64_t overruns{ 0 };        // paced ticks skipped because a frame ran long (total)
+    };
 
     // Enttec DMX USB Pro protocol constants
-    static constexpr uint8_t ENTTEC_START_MSG = 0x7E;
-    static constexpr uint8_t ENTTEC_SEND_DMX  = 0x06;
-    static constexpr uint8_t ENTTEC_END_MSG   = 0xE7;
+    static constexpr uint8_t ENTTEC_START_MSG  = 0x7E;
+    static constexpr uint8_t ENTTEC_SET_PARAMS = 0x04;
+    static constexpr uint8_t ENTTEC_SEND_DMX   = 0x06;
+    static constexpr uint8_t ENTTEC_END_MSG    = 0xE7;
     static constexpr uint16_t DMX_PAYLOAD_LEN = 513; // start code + 512 channels
+    static constexpr uint16_t PARAMS_LEN = 5;        // user config size (2) + break, MAB, rate
+    static constexpr int OUTPUTS = 2;                // Enttec framing: label 6 + one second-port label
+
+    static constexpr uint32_t BAUDRATE = 250000;
+    static constexpr int BYTE_TIME_US = 44;            // 11 bits per slot at 250 kbaud
+    static constexpr int BREAK_US = 120;               // 88+ us break low
+    static constexpr int MAB_US = 12;                  // 8+ us Mark After Break high
+    static constexpr uint32_t BREAK_BAUDRATE = 76800;  // 0x00 = 9 low bits = 117 us, 2 stop bits = 26 us
+    static constexpr int RECONNECT_COOLDOWN_MS = 5000;
+    static constexpr int STALL_TIMEOUT_MS = 100;       // a frame stuck this long resets the port
+    static constexpr int PACING_WINDOW_MS = 1000;      // pacingStats() averaging window
+    static constexpr int PACING_COARSE_US = 2000;      // paced waits sleep on the cv until this close
+
+    SerialWriter(const std::string& port, Framing framing) : _port(port), _framing(framing) {
+        for (int out = 0; out < OUTPUTS; out++) {
+            Message* m = _messages[out];
+            for (int i = 0; i < 3; i++) {
+                m[i].bytes[0] = ENTTEC_START_MSG;
+                m[i].bytes[1] = ENTTEC_SEND_DMX;
+            }
+            _back[out] = &m[0];
+            _pending[out] = &m[1];
+            _inflight[out] = &m[2];
+        }
+        _params_msg[0] = ENTTEC_START_MSG;
+        _params_msg[1] = ENTTEC_SET_PARAMS;
+        _params_msg[2] = PARAMS_LEN;
+        _params_msg[3] = 0;
+        _params_msg[4] = _params_msg[5] = 0; // user configuration size: none
+        _params_msg[4 + PARAMS_LEN] = ENTTEC_END_MSG;
+    }
+    ~SerialWriter() { stop(); }
+
+    const std::string& port() const { return _port; }
+
+    // Starts the writer thread and opens the port. Returns false if the port
+    // could not be opened; the thread keeps retrying on later frames.
+    bool start() {
+        bool opened = true;
+        try {
+            open_port();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "DMX Error: Failed to open serial port: " << e.what() << std::endl;
+            _last_reconnect = std::chrono::steady_clock::now();
+            opened = false;
+        }
+        _stop = false;
+        _thread = std::thread(&SerialWriter::run, this);
+        PortWatcher::instance().subscribe(this, [this] { ports_changed(); });
+        _watching = true;
+        return opened;
+    }
+
+    void stop() {
+        if (_watching) {
+            PortWatcher::instance().unsubscribe(this);
+            _watching = false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stop = true;
+        }
+        _cv.notify_one();
+        if (_thread.joinable())
+            _thread.join();
+        close_port();
+    }
+
+    // Hand over a frame (start code + `slots` channels, 1-512) for output 0,
+    // or output 1 on Enttec framing; never blocks on I/O. Shorter frames are
+    // valid DMX512 and refresh faster on small rigs. One submitting thread at
+    // a time (DMX calls it under send_mutex).
+    void submit(const unsigned char* frame, int slots, int output = 0) {
+        if (output < 0 || output >= OUTPUTS || (output > 0 && _framing == Framing::Raw)) return;
+        // The back buffer belongs to the submitter, so the copy needs no lock
+        Message* m = _back[output];
+        uint16_t len = static_cast<uint16_t>(1 + std::min(std::max(slots, 1), 512));
+        if (m->len != len) {
+            m->len = len;
+            m->bytes[2] = len & 0xFF;
+            m->bytes[3] = (len >> 8) & 0xFF;
+        }
+        memcpy(m->bytes + Message::DATA, frame, len);
+        m->bytes[Message::DATA + len] = ENTTEC_END_MSG;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            uint8_t bit = static_cast<uint8_t>(1u << output);
+            if (_fresh & bit) _dropped.fetch_add(1, std::memory_order_relaxed);
+            std::swap(_back[output], _pending[output]);
+            _fresh |= bit;
+            _submitted |= bit;
+        }
+        _cv.notify_one();
+    }
+
+    // Sends label 4 ahead of the next frame and again after every reconnect
+    // (Enttec framing only), so the widget paces break, MAB and refresh itself
+    void widgetParams(const WidgetParams& params) {
+        if (_framing != Framing::Enttec) return;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _params = params;
+            _has_params = true;
+            _params_dirty = true;
+        }
+        _cv.notify_one();
+    }
+
+    // Label for output 1 frames; 0 leaves output 1 unused
+    uint8_t port2Label() const { return _port2_label.load(std::memory_order_relaxed); }
+    void port2Label(uint8_t label) { _port2_label.store(label, std::memory_order_relaxed); }
+
+    uint64_t framesWritten() const { return _written.load(std::memory_order_relaxed); }
+    uint64_t framesDropped() const { return _dropped.load(std::memory_order_relaxed); }
+
+    BreakMode breakMode() const { return _break_mode.load(std::memory_order_relaxed); }
+    void breakMode(BreakMode mode) { _break_mode.store(mode, std::memory_order_relaxed); }
+
+    BreakTiming breakTiming() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _timing;
+    }
+
+    void pacing(const Pacing& pacing) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _pacing = pacing;
+            _pacing_changed = true;
+            _pacing_stats.rate_hz = _pacing_stats.jitter_us = _pacing_stats.jitter_max_us = 0;
+        }
+        _cv.notify_one();
+    }
+
+    PacingStats pacingStats() {
+        std::lock_guard<std::mutex> lock(_mutex);
+        PacingStats stats = _pacing_stats;
+        // No window has completed lately: output is idle
+        if (std::chrono::steady_clock::now() - _pacing_published > std::chrono::milliseconds(2 * PACING_WINDOW_MS))
+            stats.rate_hz = stats.jitter_us = stats.jitter_max_us = 0;
+        return stats;
+    }
+
+private:
+    // One Enttec message: header, start code + slots, end byte. Raw framing
+    // writes only the start code and slots at DATA.
+    struct Message {
+        static constexpr int DATA = 4;
+        unsigned char bytes[DATA + DMX_PAYLOAD_LEN + 1];
+        uint16_t len{ 0 };                 // start code + slots
+    };
+
+    // A run of bytes for one scatter-gather write
+    struct Chunk {
+        const unsigned char* data;
+        size_t len;
+    };
+
+    std::string _port;
+    Framing _framing;
+    serial::Serial _serial;            // writer thread only, once started
+    std::thread _thread;
+    std::mutex _mutex;                 // protects _pending, _fresh, _resend, _params*, _pacing*, _stop
+    std::condition_variable _cv;
+    // Per output, three message buffers rotate: the submitter fills _back and
+    // swaps it with _pending; the writer swaps _pending with _inflight
+    Message _messages[OUTPUTS][3];
+    Message* _back[OUTPUTS];                        // submitter only
+    Message* _pending[OUTPUTS];                     // guarded by _mutex
+    Message* _inflight[OUTPUTS];                    // writer thread only
+    uint8_t _fresh{ 0 };                            // bit per output with a pending frame
+    uint8_t _resend{ 0 };                           // bit per output whose in-flight frame goes out again
+    uint8_t _submitted{ 0 };                        // bit per output ever submitted
+    WidgetParams _params{};
+    bool _has_params{ false };
+    bool _params_dirty{ false };
+    std::atomic<uint8_t> _port2_label{ 0 };
+    std::atomic<bool> _stop{ false };
+    // The next write (writer thread): Enttec sends a params message and the
+    // in-flight message of each output in one writev; raw framing writes
+    // output 0's start code and slots only
+    unsigned char _params_msg[5 + PARAMS_LEN];
+    Chunk _wire[1 + OUTPUTS];
+    int _wire_chunks{ 0 };
+    int _wire_frames{ 0 };                         // frames carried by the current write
+    std::atomic<uint64_t> _written{ 0 };
+    std::atomic<uint64_t> _dropped{ 0 };
+    std::chrono::steady_clock::time_point _last_reconnect{};
+    std::atomic<BreakMode> _break_mode{ BreakMode::Ioctl };
+    std::atomic<bool> _open{ false };              // port open (written by the writer thread)
+    std::atomic<bool> _skip_cooldown{ false };     // a device appeared; reconnect now
+    bool _watching{ false };                       // subscribed to PortWatcher
+    BreakTiming _timing;                           // guarded by _mutex
+    Pacing _pacing{ 0, 0 };                        // guarded by _mutex
+    bool _pacing_changed{ false };                 // restart the grid (guarded by _mutex)
+    PacingStats _pacing_stats;                     // guarded by _mutex
+    std::chrono::steady_clock::time_point _pacing_published{}; // when _pacing_stats last changed
+    double _break_us{ 0 };                         // last frame's break/MAB (writer thread)
+    double _mab_us{ 0 };
+
+    void open_port() {
+        open_dmx_port(_serial, _port, STALL_TIMEOUT_MS);
+        _open = true;
+    }
+
+    void close_port() {
+        _open = false;
+        try {
+            if (_serial.isOpen())
+                _serial.close();
+        }
+        catch (...) {}
+    }
+
+    // PortWatcher callback. While the port is down, a device change lifts the
+    // reconnect cooldown and resends the newest frames, so a replugged
+    // interface lights up at once instead of after RECONNECT_COOLDOWN_MS.
+    void ports_changed() {
+        if (_open) return;
+        _skip_cooldown = true;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _resend |= _submitted;
+        }
+        _cv.notify_one();
+    }
+
+    void run() {
+#if defined(__linux__)
+        // Default 50 us timer slack would swallow most of the break timing budget
+        prctl(PR_SET_TIMERSLACK, 1UL, 0UL, 0UL, 0UL);
+#endif
+        using clock = std::chrono::steady_clock;
+        clock::time_point next_tick{};      // paced: next deadline on the grid
+        clock::time_point last_start{};     // start of the previous frame
+        clock::time_point window_start = clock::now();
+        uint64_t window_frames = 0, window_paced = 0;
+        double window_late_us = 0, window_late_max = 0;
+
+        std::unique_lock<std::mutex> lock(_mutex);
+        while (true) {
+            // Paced output keeps refreshing the newest frames once there are any
+            _cv.wait(lock, [this] {
+                return _stop || _fresh || _resend || _params_dirty || (_pacing.rate_hz > 0 && _submitted);
+            });
+            if (_stop) break;
+
+            // Let the previous frame leave the kernel queue first; anything
+            // submitted meanwhile replaces the pending frame
+            lock.unlock();
+            wait_for_drain();
+            lock.lock();
+            if (_stop) break;
+
+            // Next frame start: the next grid tick when paced, and never
+            // sooner than min_gap_us after the previous start. Submits during
+            // the wait coalesce into the pending frame.
+            auto now = clock::now();
+            auto deadline = now;
+            bool paced = _pacing.rate_hz > 0;
+            if (paced) {
+                auto period = std::chrono::duration_cast<clock::duration>(
+                    std::chrono::duration<double>(1.0 / _pacing.rate_hz));
+                if (_pacing_changed || next_tick == clock::time_point{}) {
+                    next_tick = now;
+                }
+                else if (now - next_tick > period) {
+                    // A frame ran past whole ticks: skip them and stay on the grid
+                    auto missed = (now - next_tick) / period;
+                    _pacing_stats.overruns += static_cast<uint64_t>(missed);
+                    next_tick += missed * period;
+                }
+                deadline = next_tick;
+                next_tick += period;
+            }
+            else {
+                next_tick = clock::time_point{};
+            }
+            _pacing_changed = false;
+            if (_pacing.min_gap_us > 0 && last_start != clock::time_point{})
+                deadline = std::max(deadline, last_start + std::chrono::microseconds(_pacing.min_gap_us));
+            if (deadline > now) {
+                // Sleep on the cv (stop() and pacing changes wake it), then
+                // finish with an exact absolute-deadline sleep
+                auto coarse = deadline - std::chrono::microseconds(PACING_COARSE_US);
+                if (_cv.wait_until(lock, coarse, [this] { return _stop || _pacing_changed; })) {
+                    if (_stop) break;
+                    continue;
+                }
+                lock.unlock();
+                dmx_sleep_until(deadline);
+                lock.lock();
+                if (_stop) break;
+            }
+            if (paced) _resend |= _submitted; // outputs with nothing new repeat their last frame
+
+            build_wire();
+            lock.unlock();
+            auto start = clock::now();
+            bool ok = write_frame();
+            if (ok)
+                _written.fetch_add(_wire_frames, std::memory_order_relaxed);
+            else
+                _dropped.fetch_add(_wire_frames, std::memory_order_relaxed);
+            lock.lock();
+            bool idle = start - last_start > std::chrono::milliseconds(2 * PACING_WINDOW_MS);
+            last_start = start;
+            if (idle) {
+                // Start a fresh window at this frame rather than average the gap in
+                window_start = start;
+                window_frames = window_paced = 0;
+                window_late_us = window_late_max = 0;
+            }
+            else {
+                window_frames++;
+                if (paced) {
+                    double late = std::chrono::duration<double, std::micro>(start - deadline).count();
+                    window_paced++;
+                    window_late_us += late;
+                    window_late_max = std::max(window_late_max, late);
+                }
+                double window = std::chrono::duration<double>(start - window_start).count();
+                if (window * 1000 >= PACING_WINDOW_MS) {
+                    _pacing_stats.rate_hz = window_frames / window;
+                    _pacing_stats.jitter_us = window_paced ? window_late_us / window_paced : 0;
+                    _pacing_stats.jitter_max_us = window_late_max;
+                    _pacing_published = start;
+                    window_start = start;
+                    window_frames = window_paced = 0;
+                    window_late_us = window_late_max = 0;
+                }
+            }
+            if (ok && _framing == Framing::Raw) {
+                _timing.frames++;
+                _timing.break_us_total += _break_us;
+                _timing.mab_us_total += _mab_us;
+                _timing.break_us_max = std::max(_timing.break_us_max, _break_us);
+                _timing.mab_us_max = std::max(_timing.mab_us_max, _mab_us);
+            }
+        }
+    }
+
+    // Takes the newest pending frames in flight and lists the next write in
+    // _wire; called under _mutex. Swaps buffers only, never copies frames.
+    void build_wire() {
+        _wire_chunks = 0;
+        _wire_frames = 0;
+        uint8_t outputs = _fresh | _resend;
+        for (int out = 0; out < OUTPUTS; out++)
+            if (_fresh & (1u << out)) std::swap(_pending[out], _inflight[out]);
+        _fresh = 0;
+        _resend = 0;
+        if (_framing == Framing::Raw) {
+            if (!(outputs & 1u)) return;
+            _wire[_wire_chunks++] = { _inflight[0]->bytes + Message::DATA, _inflight[0]->len };
+            _wire_frames = 1;
+            return;
+        }
+        if (_params_dirty) {
+            _params_msg[6] = _params.break_time;
+            _params_msg[7] = _params.mab_time;
+            _params_msg[8] = _params.rate;
+            _wire[_wire_chunks++] = { _params_msg, sizeof(_params_msg) };
+            _params_dirty = false;
+        }
+        for (int out = 0; out < OUTPUTS; out++) {
+            if (!(outputs & (1u << out))) continue;
+            uint8_t label = out == 0 ? ENTTEC_SEND_DMX : _port2_label.load(std::memory_order_relaxed);
+            if (label == 0) continue;
+            Message* m = _inflight[out];
+            m->bytes[1] = label;
+            _wire[_wire_chunks++] = { m->bytes, static_cast<size_t>(Message::DATA + m->len + 1) };
+            _wire_frames++;
+        }
+    }
+
+    void wait_for_drain() {
+#ifndef _WIN32
+        int fd = _serial.getFd();
+        if (fd < 0) return;
+        while (!_stop) {
+            int queued = 0;
+            if (ioctl(fd, TIOCOUTQ, &queued) < 0 || queued <= 0) return;
+            // Sleep roughly until the queue is empty; the USB side may lag a little
+            dmx_usleep(static_cast<unsigned>(std::min(queued * BYTE_TIME_US, STALL_TIMEOUT_MS * 1000)));
+        }
+#endif
+    }
+
+    bool reopen() {
+        auto now = std::chrono::steady_clock::now();
+        bool skip_cooldown = _skip_cooldown.exchange(false);
+        if (!skip_cooldown && now - _last_reconnect < std::chrono::milliseconds(RECONNECT_COOLDOWN_MS))
+            return false;
+        _last_reconnect = now;
+        try {
+            open_port();
+            // A replugged widget has lost its parameters; resend them with the next frame
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_has_params) _params_dirty = true;
+            return true;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "DMX Warning: Failed to open serial port: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    bool write_frame() {
+        if (_wire_chunks == 0) return true;
+        if (!_serial.isOpen() && !reopen()) return false;
+
+        try {
+            if (_framing == Framing::Raw) {
+                // Break condition for "raw" FTDI/RS485 interfaces (OpenDMX style)
+                if (write_break() && write_all(_wire, _wire_chunks)) return true; // start code + slots
+            }
+            else {
+                // Buffered interfaces (e.g., Enttec DMX USB Pro, DMXking, DSD Tech);
+                // messages were framed by build_wire()
+                if (write_all(_wire, _wire_chunks)) return true;
+            }
+            std::cerr << "DMX Error: Serial write stalled for " << STALL_TIMEOUT_MS << " ms, resetting port." << std::endl;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "DMX Error: Serial write error: " << e.what() << std::endl;
+        }
+        close_port();
+        return false;
+    }
+
+    // Break + Mark After Break ahead of a raw frame. Returns false if the
+    // break byte stalled; throws on port errors.
+    bool write_break() {
+        using clock = std::chrono::steady_clock;
+        auto t0 = clock::now();
+#ifdef DMX_HAVE_TERMIOS2
+        if (_break_mode.load(std::memory_order_relaxed) == BreakMode::Baud) {
+            static const unsigned char BREAK_BYTE = 0x00;
+            int fd = _serial.getFd();
+            // Draining switches: the previous frame must leave at 250k, the break byte at 76.8k
+            if (dmx_set_baud(fd, BREAK_BAUDRATE, true)) {
+                t0 = clock::now();
+                if (!write_all(&BREAK_BYTE, 1)) return false;
+                if (!dmx_set_baud(fd, BAUDRATE, true))
+                    throw std::runtime_error(std::string("baud restore failed: ") + strerror(errno));
+                // The UART times the byte itself (start + 8 zero bits low, 2 stop
+                // bits high); any time the drain took beyond that idles the line
+                // high and lengthens the MAB
+                const double byte_us = 11 * 1e6 / BREAK_BAUDRATE;
+                double elapsed = std::chrono::duration<double, std::micro>(clock::now() - t0).count();
+                _break_us = 9 * 1e6 / BREAK_BAUDRATE;
+                _mab_us = 2 * 1e6 / BREAK_BAUDRATE + std::max(0.0, elapsed - byte_us);
+                return true;
+            }
+            std::cerr << "DMX Warning: Serial port does not support BREAK_BAUD (" << strerror(errno)
+                      << "); using BREAK_IOCTL." << std::endl;
+            _break_mode.store(BreakMode::Ioctl, std::memory_order_relaxed);
+            t0 = clock::now();
+        }
+#endif
+        _serial.setBreak(true);
+        dmx_sleep_until(t0 + std::chrono::microseconds(BREAK_US));
+        _serial.setBreak(false);
+        auto t_mark = clock::now();
+        dmx_sleep_until(t_mark + std::chrono::microseconds(MAB_US));
+        auto t_data = clock::now();
+        _break_us = std::chrono::duration<double, std::micro>(t_mark - t0).count();
+        _mab_us = std::chrono::duration<double, std::micro>(t_data - t_mark).count();
+        return true;
+    }
+
+    bool write_all(const unsigned char* buf, size_t len) {
+        Chunk chunk{ buf, len };
+        return write_all(&chunk, 1);
+    }
+
+    // Writes every chunk in order (one writev per attempt on POSIX) or gives
+    // up after STALL_TIMEOUT_MS. Chunks are consumed as they are written.
+    bool write_all(Chunk* chunks, int count) {
+#ifndef _WIN32
+        int fd = _serial.getFd();
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(STALL_TIMEOUT_MS);
+        iovec iov[1 + OUTPUTS];
+        while (count > 0 && chunks->len == 0) { chunks++; count--; }
+        while (count > 0) {
+            int n_iov = std::min(count, 1 + OUTPUTS);
+            for (int i = 0; i < n_iov; i++)
+                iov[i] = { const_cast<unsigned char*>(chunks[i].data), chunks[i].len };
+            ssize_t n = ::writev(fd, iov, n_iov);
+            if (n > 0) {
+                // Skip what went out; a partial write resumes mid-chunk
+                size_t left = static_cast<size_t>(n);
+                while (count > 0 && left >= chunks->len) { left -= chunks->len; chunks++; count--; }
+                if (count > 0) { chunks->data += left; chunks->len -= left; }
+                continue;
+            }
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+                throw std::runtime_error(strerror(errno));
+            auto left = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            if (left.count() <= 0) {
+                tcflush(fd, TCOFLUSH);
+                return false;
+            }
+            pollfd pfd{ fd, POLLOUT, 0 };
+            poll(&pfd, 1, static_cast<int>(left.count()));
+        }
+        return true;
+#else
+        for (int i = 0; i < count; i++)
+            if (_serial.write(chunks[i].data, chunks[i].len) != chunks[i].len) return false;
+        return true;
+#endif
+    }
+};
+
+// Serial DMX input from one port, decoded on its own reader thread. Complete
+// frames are published through a triple buffer, so the VM reads the newest
+// one without locking; on_change runs on the reader thread whenever a frame
+// with different levels arrives. Enttec framing decodes "received DMX"
+// messages (label 5); raw framing splits the stream at line breaks, which
+// PARMRK reports in-band as 0xFF 0x00 0x00 (POSIX only).
+class SerialReader {
+public:
+    struct InputFrame {
+        uint32_t sequence;                 // bumped for every changed frame
+        uint16_t slots;                    // channels in data (after the start code)
+        unsigned char data[513];           // start code + up to 512 levels
+    };
+
+    static constexpr uint8_t ENTTEC_RECEIVED_DMX = 0x05;
+    static constexpr int POLL_MS = 100;                 // stop() latency
+    static constexpr int RECONNECT_COOLDOWN_MS = 5000;
+
+    SerialReader(const std::string& port, SerialWriter::Framing framing, std::function<void()> on_change)
+        : _port(port), _framing(framing), _on_change(std::move(on_change)) {}
+    ~SerialReader() { stop(); }
+
+    const std::string& port() const { return _port; }
+
+    // Opens the port and starts the reader thread. Returns false if the port
+    // could not be opened; the thread keeps retrying.
+    bool start() {
+        bool opened = open_port();
+        if (!opened) _last_reconnect = std::chrono::steady_clock::now();
+        _stop = false;
+        _thread = std::thread(&SerialReader::run, this);
+        // A device change lets a down port reconnect without the cooldown
+        PortWatcher::instance().subscribe(this, [this] { _skip_cooldown = true; });
+        _watching = true;
+        return opened;
+    }
+
+    void stop() {
+        if (_watching) {
+            PortWatcher::instance().unsubscribe(this);
+            _watching = false;
+        }
+        _stop = true;
+        if (_thread.joinable())
+            _thread.join();
+        close_port();
+    }
+
+    // Newest complete frame, or nullptr before the first one (reader side of
+    // the triple buffer: call from one thread only)
+    const InputFrame* latest() {
+        _frames.acquire();
+        const InputFrame& f = _frames.front();
+        return f.sequence ? &f : nullptr;
+    }
+
+    uint64_t framesReceived() const { return _received.load(std::memory_order_relaxed); }
+    uint64_t framesDiscarded() const { return _discarded.load(std::memory_order_relaxed); }
+
+private:
+    enum class Parse { Start, Label, LenLo, LenHi, Data, End };
+
+    std::string _port;
+    SerialWriter::Framing _framing;
+    std::function<void()> _on_change;
+    serial::Serial _serial;                // reader thread only, once started
+    std::thread _thread;
+    std::atomic<bool> _stop{ false };
+    std::atomic<bool> _skip_cooldown{ false };
+    bool _watching{ false };
+    std::chrono::steady_clock::time_point _last_reconnect{};
+    TripleBuffer<InputFrame> _frames;
+    std::atomic<uint64_t> _received{ 0 };
+    std::atomic<uint64_t> _discarded{ 0 };
+    // Decoder state (reader thread)
+    unsigned char _last[513]{};            // levels of the last published frame
+    uint16_t _last_len{ 0 };
+    uint32_t _sequence{ 0 };
+    unsigned char _msg[600];               // Enttec message body / raw frame being assembled
+    size_t _len{ 0 };
+    Parse _state{ Parse::Start };
+    uint8_t _label{ 0 };
+    uint16_t _msg_len{ 0 };
+    int _marks{ 0 };                       // raw: bytes of a PARMRK sequence seen so far
+    bool _in_frame{ false };               // raw: a break has been seen
+    bool _frame_bad{ false };              // raw: framing/parity error inside the frame
+
+    bool open_port() {
+        try {
+            open_dmx_port(_serial, _port, POLL_MS);
+#ifndef _WIN32
+            if (_framing == SerialWriter::Framing::Raw) {
+                // Report breaks and framing errors in-band instead of dropping them
+                termios tio;
+                int fd = _serial.getFd();
+                if (tcgetattr(fd, &tio) == 0) {
+                    tio.c_iflag &= ~(IGNBRK | BRKINT | IGNPAR | ISTRIP);
+                    tio.c_iflag |= PARMRK;
+                    tcsetattr(fd, TCSANOW, &tio);
+                }
+            }
+#endif
+            reset_decoder();
+            return true;
+        }
+        catch (const std::exception& e) {
+            std::cerr << "DMX Warning: Failed to open serial input port: " << e.what() << std::endl;
+            return false;
+        }
+    }
+
+    void close_port() {
+        try {
+            if (_serial.isOpen())
+                _serial.close();
+        }
+        catch (...) {}
+    }
+
+    void reset_decoder() {
+        _state = Parse::Start;
+        _len = 0;
+        _marks = 0;
+        _in_frame = false;
+        _frame_bad = false;
+    }
+
+    void run() {
+        unsigned char buf[1024];
+        while (!_stop) {
+            if (!_serial.isOpen()) {
+                auto now = std::chrono::steady_clock::now();
+                bool skip_cooldown = _skip_cooldown.exchange(false);
+                if (!skip_cooldown && now - _last_reconnect < std::chrono::milliseconds(RECONNECT_COOLDOWN_MS)) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(POLL_MS));
+                    continue;
+                }
+                _last_reconnect = now;
+                if (!open_port()) continue;
+            }
+            long n = read_some(buf, sizeof(buf));
+            if (n < 0) {
+                std::cerr << "DMX Warning: Serial input error on " << _port << ", reconnecting." << std::endl;
+                close_port();
+                _last_reconnect = std::chrono::steady_clock::now();
+                continue;
+            }
+            for (long i = 0; i < n; i++) {
+                if (_framing == SerialWriter::Framing::Enttec) feed_enttec(buf[i]);
+                else feed_raw(buf[i]);
+            }
+        }
+    }
+
+    // Up to len bytes, 0 on timeout, -1 if the port failed
+    long read_some(unsigned char* buf, size_t len) {
+#ifndef _WIN32
+        int fd = _serial.getFd();
+        pollfd pfd{ fd, POLLIN, 0 };
+        int r = poll(&pfd, 1, POLL_MS);
+        if (r < 0) return errno == EINTR ? 0 : -1;
+        if (r == 0) return 0;
+        if (pfd.revents & (POLLERR | POLLHUP | POLLNVAL)) return -1;
+        ssize_t n = ::read(fd, buf, len);
+        if (n < 0) return (errno == EAGAIN || errno == EINTR) ? 0 : -1;
+        return n == 0 ? -1 : n; // 0 = hung up
+#else
+        try {
+            // Blocks up to the port timeout for the first byte, then takes what is buffered
+            if (_serial.read(buf, 1) == 0) return 0;
+            return 1 + static_cast<long>(_serial.read(buf + 1, std::min(len - 1, _serial.available())));
+        }
+        catch (...) {
+            return -1;
+        }
+#endif
+    }
+
+    void feed_enttec(unsigned char b) {
+        switch (_state) {
+        case Parse::Start:
+            if (b == SerialWriter::ENTTEC_START_MSG) _state = Parse::Label;
+            break;
+        case Parse::Label:
+            _label = b;
+            _state = Parse::LenLo;
+            break;
+        case Parse::LenLo:
+            _msg_len = b;
+            _state = Parse::LenHi;
+            break;
+        case Parse::LenHi:
+            _msg_len |= static_cast<uint16_t>(b << 8);
+            _len = 0;
+            if (_msg_len > sizeof(_msg)) { _state = Parse::Start; _discarded.fetch_add(1, std::memory_order_relaxed); }
+            else _state = _msg_len ? Parse::Data : Parse::End;
+            break;
+        case Parse::Data:
+            _msg[_len++] = b;
+            if (_len == _msg_len) _state = Parse::End;
+            break;
+        case Parse::End:
+            _state = Parse::Start;
+            if (b != SerialWriter::ENTTEC_END_MSG) { _discarded.fetch_add(1, std::memory_order_relaxed); break; }
+            if (_label != ENTTEC_RECEIVED_DMX) break;
+            // Body: status byte (non-zero = overrun or queue overflow), start code, levels
+            if (_msg_len < 2 || _msg[0] != 0) { _discarded.fetch_add(1, std::memory_order_relaxed); break; }
+            publish(_msg + 1, _msg_len - 1);
+            break;
+        }
+    }
+
+    void feed_raw(unsigned char b) {
+        // PARMRK: 0xFF 0xFF = data 0xFF, 0xFF 0x00 0x00 = break, 0xFF 0x00 X = bad byte X
+        if (_marks == 0 && b == 0xFF) { _marks = 1; return; }
+        if (_marks == 1) {
+            _marks = 0;
+            if (b == 0x00) { _marks = 2; return; }
+            // 0xFF 0xFF: a literal 0xFF
+        }
+        else if (_marks == 2) {
+            _marks = 0;
+            if (b == 0x00) { on_break(); return; }
+            _frame_bad = true;
+            return;
+        }
+        if (!_in_frame) return;
+        if (_len < DMX_FRAME_BYTES) _msg[_len++] = b;
+    }
+
+    void on_break() {
+        // The frame before a break is complete
+        if (_in_frame && _len >= 2) {
+            if (_frame_bad) _discarded.fetch_add(1, std::memory_order_relaxed);
+            else publish(_msg, _len);
+        }
+        _in_frame = true;
+        _frame_bad = false;
+        _len = 0;
+    }
+
+    static constexpr size_t DMX_FRAME_BYTES = 513;
+
+    // data = start code + levels; only null start code frames carry levels
+    void publish(const unsigned char* data, size_t len) {
+        if (data[0] != 0x00) return;
+        len = std::min(len, DMX_FRAME_BYTES);
+        _received.fetch_add(1, std::memory_order_relaxed);
+        if (len == _last_len && memcmp(_last, data, len) == 0) return;
+        memcpy(_last, data, len);
+        _last_len = static_cast<uint16_t>(len);
+        InputFrame& f = _frames.back();
+        f.sequence = ++_sequence;
+        f.slots = static_cast<uint16_t>(len - 1);
+        memcpy(f.data, data, len);
+        if (len < DMX_FRAME_BYTES) memset(f.data + len, 0, DMX_FRAME_BYTES - len);
+        _frames.publish();
+        if (_on_change) _on_change();
+    }
+};
+
+class DMX {
+    friend struct DMXBench; // bench/ harnesses poke at internals
+public:
+    enum class Protocol { Serial_Raw, Serial, sACN, ArtNet };
+    enum class Clock { System, ChucK };
 
     // Reconnect backoff
     static constexpr int RECONNECT_COOLDOWN_MS = 5000;
 
+    // Unchanged universes are only retransmitted at these keep-alive intervals.
+    // sACN needs none: the library's own thread keeps suppressed universes alive.
+    static constexpr int ARTNET_KEEPALIVE_MS = 1000;
+    static constexpr int SERIAL_KEEPALIVE_MS = 1000;  // Enttec-style widgets repeat the last frame themselves
+    static constexpr uint32_t NEVER_SENT = 0xFFFFFFFF;
+
+    // Async output refresh rate bounds (Hz); 44 Hz is the full-frame DMX512 maximum
+    static constexpr double DEFAULT_REFRESH_HZ = 44.0;
+    static constexpr double MIN_REFRESH_HZ = 1.0;
+    static constexpr double MAX_REFRESH_HZ = 1000.0;
+
     // Limits
-    static constexpr int MAX_UNIVERSES = 64;
-    static constexpr int ARTNET_MAX_PORTS = 4;
-
-    struct FadeState {
-        bool active;
-        unsigned char start_value;
-        unsigned char target_value;
-        std::chrono::steady_clock::time_point start_time;
-        std::chrono::milliseconds duration;
+    static constexpr int MIN_UNIVERSE = 1;
+    static constexpr int MAX_UNIVERSE = 63999;
+    static constexpr int ARTNET_MAX_UNIVERSE = ARTNET_MAX_PORT_ADDR + 1; // universe 1 = Port-Address 0:0:0
+
+    // ArtNet discovery: poll every 2.5 s (the spec's 2.5-3 s), forget nodes that
+    // missed three polls, and unicast to at most this many nodes per universe
+    static constexpr int ARTNET_POLL_INTERVAL_MS = 2500;
+    static constexpr int ARTNET_NODE_TIMEOUT_S = 8;
+    static constexpr int ARTNET_READER_WAKE_MS = 100;  // stop-flag latency of the reader thread
+    static constexpr int DEFAULT_ARTNET_UNICAST = 10;
+    static constexpr int MAX_ARTNET_UNICAST = 30;      // libartnet's bcast limit ceiling
+
+    // Dense universe index sentinel: universe number has no arena slot
+    static constexpr uint16_t NO_SLOT = 0xFFFF;
+
+    // Running fades of one universe, packed as a structure of arrays so that
+    // stepping touches only the active entries. Levels are 16.16 fixed point;
+    // the per-ms step keeps 32 fractional bits so multi-minute fades don't drift.
+    struct FadeList {
+        static constexpr uint16_t IDLE = 0xFFFF;
+        int count{ 0 };
+        uint16_t channel[512];
+        uint8_t  target[512];
+        int32_t  start_fx[512];     // start level, 16.16
+        int64_t  step[512];         // level change per ms, 32.32
+        uint32_t start_ms[512];
+        uint32_t duration_ms[512];
+        uint16_t index_of[513];     // channel -> list position, or IDLE
+
+        FadeList() {
+            for (int i = 0; i < 513; i++) index_of[i] = IDLE;
+        }
+
+        void start(int ch, uint8_t from, uint8_t to, uint32_t now_ms, uint32_t dur_ms) {
+            int i = index_of[ch];
+            if (i == IDLE) {
+                i = count++;
+                index_of[ch] = static_cast<uint16_t>(i);
+                channel[i] = static_cast<uint16_t>(ch);
+            }
+            target[i] = to;
+            start_fx[i] = static_cast<int32_t>(from) << 16;
+            step[i] = (static_cast<int64_t>(to) - from) * (INT64_C(1) << 32) / static_cast<int64_t>(dur_ms);
+            start_ms[i] = now_ms;
+            duration_ms[i] = dur_ms;
+        }
+
+        // Swap-remove entry i (the last entry moves into its place)
+        void remove_at(int i) {
+            index_of[channel[i]] = IDLE;
+            int last = --count;
+            if (i != last) {
+                channel[i] = channel[last];
+                target[i] = target[last];
+                start_fx[i] = start_fx[last];
+                step[i] = step[last];
+                start_ms[i] = start_ms[last];
+                duration_ms[i] = duration_ms[last];
+                index_of[channel[i]] = static_cast<uint16_t>(i);
+            }
+        }
+
+        void cancel(int ch) {
+            if (index_of[ch] != IDLE) remove_at(index_of[ch]);
+        }
+
+        void clear() {
+            for (int i = 0; i < count; i++) index_of[channel[i]] = IDLE;
+            count = 0;
+        }
     };
 
-    struct UniverseData {
-        unsigned char dmx_data[513];
-        FadeState fades[513];
-        int active_fade_count{0};
-        UniverseData() {
+    // Whole-universe scene transition from one full frame to another, blended
+    // in a single vector pass per update instead of 512 per-channel fades
+    struct Crossfade {
+        bool active{ false };
+        uint32_t start_ms{ 0 };
+        uint32_t duration_ms{ 0 };
+        unsigned last_weight{ 0 };
+        alignas(32) uint8_t from[512];
+        alignas(32) uint8_t to[512];
+    };
+
+    struct Frame {
+        uint32_t generation;               // bumped each time the universe publishes a changed frame
+        uint16_t slots;                    // channels worth sending (serial may truncate to this)
+        unsigned char data[513];
+    };
+
+    // One arena slot per universe; cache-line aligned so neighbouring slots never
+    // share a line between the VM thread's writes and the transmitter's reads
+    struct alignas(64) UniverseData {
+        int universe;
+        std::unique_ptr<FadeList> fades;    // allocated on first fade()
+        std::unique_ptr<Crossfade> xfade;   // allocated on first crossfade()
+        bool fading_listed{ false };        // present in DMX::_fading_universes
+        unsigned char dmx_data[513];        // working frame, written by the VM thread only
+        bool dirty{ true };                 // working frame changed since last publish (VM thread)
+        uint16_t used_slots{ 0 };           // highest channel ever written (VM thread)
+        uint32_t generation{ 0 };           // generation of the last published frame (VM thread)
+        TripleBuffer<Frame> frames;         // published frames, read by the transmitter
+        uint32_t sent_generation{ NEVER_SENT };                  // transmitter only
+        std::chrono::steady_clock::time_point last_sent{};      // transmitter only
+        uint8_t artnet_sequence{ 0 };                           // transmitter only
+        explicit UniverseData(int uni) : universe(uni) {
             memset(dmx_data, 0, sizeof(dmx_data));
-            memset(fades, 0, sizeof(fades));
+        }
+        UniverseData(UniverseData&&) noexcept = default;
+        UniverseData& operator=(UniverseData&&) noexcept = default;
+
+        FadeList& fade_list() {
+            if (!fades) fades.reset(new FadeList());
+            return *fades;
+        }
+        bool has_fade_list() const { return fades != nullptr; }
+        int active_fade_count() const { return fades ? fades->count : 0; }
+        bool crossfading() const { return xfade && xfade->active; }
+        bool animating() const { return active_fade_count() > 0 || crossfading(); }
+        void set(int ch, unsigned char value) {
+            if (ch > used_slots) use_slots(ch);
+            if (dmx_data[ch] != value) {
+                dmx_data[ch] = value;
+                dirty = true;
+            }
+        }
+        void use_slots(int last_ch) {
+            if (last_ch > used_slots) {
+                used_slots = static_cast<uint16_t>(last_ch);
+                dirty = true; // frame length changed
+            }
+        }
+        void cancel_fade(int ch) {
+            if (fades) fades->cancel(ch);
+        }
+        // Pin a channel inside a running crossfade so the blend holds it at value
+        void pin(int ch, unsigned char value) {
+            if (crossfading()) xfade->from[ch - 1] = xfade->to[ch - 1] = value;
+        }
+        // Direct write: overrides any fade or crossfade on the channel
+        void write(int ch, unsigned char value) {
+            cancel_fade(ch);
+            pin(ch, value);
+            set(ch, value);
+        }
+        // Bulk write of channels first..first+n-1 (already range-checked)
+        void write_range(int first, const unsigned char* values, int n) {
+            if (active_fade_count() > 0) {
+                if (n == 512) fades->clear();
+                else for (int ch = first; ch < first + n; ch++) fades->cancel(ch);
+            }
+            if (crossfading()) {
+                if (n == 512) xfade->active = false;
+                else {
+                    memcpy(xfade->from + first - 1, values, n);
+                    memcpy(xfade->to + first - 1, values, n);
+                }
+            }
+            use_slots(first + n - 1);
+            if (memcmp(dmx_data + first, values, n) != 0) {
+                memcpy(dmx_data + first, values, n);
+                dirty = true;
+            }
         }
     };
 
-    struct ArtNetMapping {
-        int universe;
-        int port_idx;
+    // A frame queued by sendAt(): the working frames of every universe at the
+    // time of the call, transmitted once its due time is reached
+    struct ScheduledFrame {
+        t_CKTIME due;                                   // ChucK time (samples)
+        std::chrono::steady_clock::time_point due_wall; // due, mapped to wall clock for the output thread
+        std::vector<int> universes;
+        std::vector<unsigned char> data;                // 512 levels per entry in universes
     };
 
-    DMX() {
-        _universes[1]; // default universe 1
+    DMX() : _slot_index(MAX_UNIVERSE + 1, NO_SLOT) {
+        create_universe(1); // default universe 1
     }
 
     ~DMX() {
+        stop_output_thread();
         deinit_all();
+        _input.reset();
+        if (_input_event) _api->object->release(_input_event);
+        if (_ports_event) {
+            PortWatcher::instance().unsubscribe(this);
+            _api->object->release(_ports_event);
+        }
+    }
+
+    // Gives the instance access to ChucK logical time (clock mode and sendAt)
+    void attach_vm(Chuck_VM* vm, CK_DL_API api) {
+        _vm = vm;
+        _api = api;
     }
 
     Protocol protocol() {
@@ -176,11 +1570,9 @@ public:
 
     int get_channel(int ch) {
         if (ch < 1 || ch > 512) return 0;
-        int uni = _active_universe;
-        std::lock_guard<std::mutex> lock(dmx_mutex);
-        auto it = _universes.find(uni);
-        if (it == _universes.end()) return 0;
-        return it->second.dmx_data[ch];
+        UniverseData* udata = find_universe(_active_universe);
+        if (!udata) return 0;
+        return udata->dmx_data[ch];
     }
 
     void channel(int ch, int value) {
@@ -192,26 +1584,14 @@ public:
             std::cerr << "DMX Warning: channel() value " << value << " clamped to 0-255." << std::endl;
             value = clamp_dmx(value);
         }
-        int uni = _active_universe;
-        // Cancel any active fade on this channel
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            auto it = _universes.find(uni);
-            if (it != _universes.end() && it->second.fades[ch].active) {
-                it->second.fades[ch].active = false;
-                it->second.active_fade_count--;
-            }
-        }
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            auto it = _universes.find(uni);
-            if (it != _universes.end())
-                it->second.dmx_data[ch] = static_cast<unsigned char>(value);
-        }
+        UniverseData* udata = find_universe(_active_universe);
+        if (!udata) return;
+        // Cancels any active fade on this channel
+        udata->write(ch, static_cast<unsigned char>(value));
     }
 
     void channel(int uni, int ch, int value) {
-        if (uni < 1 || uni > 63999) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
             std::cerr << "DMX Warning: channel() universe " << uni << " out of range (1-63999), ignored." << std::endl;
             return;
         }
@@ -223,79 +1603,67 @@ public:
             std::cerr << "DMX Warning: channel() value " << value << " clamped to 0-255." << std::endl;
             value = clamp_dmx(value);
         }
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            auto it = _universes.find(uni);
-            if (it == _universes.end()) return;
-            if (it->second.fades[ch].active) {
-                it->second.fades[ch].active = false;
-                it->second.active_fade_count--;
-            }
-        }
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            auto it = _universes.find(uni);
-            if (it != _universes.end())
-                it->second.dmx_data[ch] = static_cast<unsigned char>(value);
-        }
+        UniverseData* udata = find_universe(uni);
+        if (!udata) return;
+        udata->write(ch, static_cast<unsigned char>(value));
     }
 
     void channels(int startCh, const unsigned char* values, int count) {
-        int uni = _active_universe;
-        // Cancel fades for affected channels
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            auto it = _universes.find(uni);
-            if (it != _universes.end()) {
-                for (int i = 0; i < count; i++) {
-                    int ch = startCh + i;
-                    if (ch >= 1 && ch <= 512 && it->second.fades[ch].active) {
-                        it->second.fades[ch].active = false;
-                        it->second.active_fade_count--;
-                    }
-                }
-            }
+        UniverseData* udata = find_universe(_active_universe);
+        if (!udata) return;
+        // Clip to channels 1-512; cancels fades for affected channels
+        if (startCh > 512 || count <= 0) return;
+        if (startCh < 1) {
+            long long skip = 1LL - startCh;
+            if (skip >= count) return;
+            values += skip;
+            count -= static_cast<int>(skip);
+            startCh = 1;
         }
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            auto it = _universes.find(uni);
-            if (it != _universes.end()) {
-                for (int i = 0; i < count; i++) {
-                    int ch = startCh + i;
-                    if (ch < 1 || ch > 512) continue;
-                    it->second.dmx_data[ch] = values[i];
-                }
-            }
+        if (startCh + count > 513) count = 513 - startCh;
+        udata->write_range(startCh, values, count);
+    }
+
+    // Replace channels 1..count of a universe in one write; channels past
+    // count are untouched. Cancels fades and crossfades on affected channels.
+    void frame(int uni, const unsigned char* values, int count) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
+            std::cerr << "DMX Warning: frame() universe " << uni << " out of range (1-63999), ignored." << std::endl;
+            return;
+        }
+        UniverseData* udata = find_universe(uni);
+        if (!udata) {
+            std::cerr << "DMX Warning: frame() universe " << uni << " does not exist, ignored." << std::endl;
+            return;
         }
+        if (count > 512) count = 512;
+        if (count <= 0) return;
+        udata->write_range(1, values, count);
+    }
+
+    // Current levels of channels 1-512, or nullptr if the universe does not exist
+    const unsigned char* get_frame(int uni) {
+        UniverseData* udata = find_universe(uni);
+        return udata ? udata->dmx_data + 1 : nullptr;
     }
 
     void blackout() {
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            for (auto& [uni, udata] : _universes) {
-                for (int i = 1; i <= 512; i++)
-                    udata.fades[i].active = false;
-                udata.active_fade_count = 0;
-                memset(udata.dmx_data + 1, 0, 512);
-            }
+        for (auto& udata : _universes) {
+            if (udata.fades) udata.fades->clear();
+            if (udata.xfade) udata.xfade->active = false;
+            memset(udata.dmx_data + 1, 0, 512);
+            udata.dirty = true;
         }
     }
 
     bool init() {
-        // Snapshot universe keys under dmx_mutex (before acquiring state_mutex)
-        std::vector<int> uni_keys;
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            for (auto& [k, v] : _universes)
-                uni_keys.push_back(k);
-        }
-
         bool ok = false;
         {
+            std::lock_guard<std::mutex> slock(send_mutex);
             std::lock_guard<std::mutex> lock(state_mutex);
 
             deinit_all();
+            mark_all_unsent();
 
             switch (_protocol) {
             case Protocol::Serial_Raw:
@@ -303,10 +1671,10 @@ public:
                 ok = init_Serial();
                 break;
             case Protocol::sACN:
-                ok = init_sACN(uni_keys);
+                ok = init_sACN(_universe_keys);
                 break;
             case Protocol::ArtNet:
-                ok = init_ArtNet(uni_keys);
+                ok = init_ArtNet(_universe_keys);
                 break;
             }
         }
@@ -318,112 +1686,119 @@ public:
         // Advance any active fades based on elapsed wall-clock time
         update_fades();
 
-        // State snapshot under state_mutex (before data snapshot)
-        Protocol current_protocol;
-        ArtNetMapping artnet_snap[ARTNET_MAX_PORTS];
-        int artnet_snap_count;
-        {
-            std::lock_guard<std::mutex> lock(state_mutex);
-            current_protocol = _protocol;
-            artnet_snap_count = _artnet_mapping_count;
-            memcpy(artnet_snap, _artnet_mappings, sizeof(ArtNetMapping) * artnet_snap_count);
-        }
-
-        // Snapshot all universe data under dmx_mutex
-        struct Snapshot { int universe; unsigned char data[513]; };
-        std::vector<Snapshot> snapshots;
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            snapshots.reserve(_universes.size());
-            for (auto& [uni, udata] : _universes) {
-                snapshots.emplace_back();
-                snapshots.back().universe = uni;
-                memcpy(snapshots.back().data, udata.dmx_data, 513);
-            }
+        // Publish every changed universe's working frame; lock-free, the
+        // transmitter picks up the newest complete frame on its next pass.
+        // Unchanged universes publish nothing and fall back to keep-alive rates.
+        for (auto& udata : _universes) {
+            if (!udata.dirty) continue;
+            Frame& f = udata.frames.back();
+            f.generation = ++udata.generation;
+            f.slots = std::max(udata.used_slots, _min_slots);
+            memcpy(f.data, udata.dmx_data, 513);
+            udata.frames.publish();
+            udata.dirty = false;
         }
 
         // Debug: print channel values before sending
         if (_debug) {
-            for (auto& snap : snapshots) {
+            for (auto& udata : _universes) {
+                const unsigned char* d = udata.dmx_data;
                 fprintf(stderr, "DMX send: uni=%d ch[1..10]=[%d,%d,%d,%d,%d,%d,%d,%d,%d,%d]\n",
-                    snap.universe,
-                    snap.data[1], snap.data[2], snap.data[3], snap.data[4], snap.data[5],
-                    snap.data[6], snap.data[7], snap.data[8], snap.data[9], snap.data[10]);
+                    udata.universe, d[1], d[2], d[3], d[4], d[5], d[6], d[7], d[8], d[9], d[10]);
             }
         }
 
-        // Serialize protocol I/O — sACN and ArtNet libraries are not thread-safe
-        std::lock_guard<std::mutex> slock(send_mutex);
-
-        switch (current_protocol) {
-        case Protocol::Serial_Raw:
-        case Protocol::Serial: {
-            // Serial only sends the active universe
-            int active = _active_universe;
-            for (auto& snap : snapshots) {
-                if (snap.universe == active) {
-                    send_Serial(snap.data, current_protocol);
-                    break;
-                }
-            }
-            break;
+        // Async mode: the output thread owns I/O; just flag that a frame exists
+        if (_output_running.load(std::memory_order_acquire)) {
+            _frame_published.store(true, std::memory_order_release);
+            return;
         }
-        case Protocol::sACN: {
-            bool any_failed = false;
-            for (auto& snap : snapshots) {
-                try {
-                    source.UpdateLevels(static_cast<uint16_t>(snap.universe), snap.data + 1, 512);
-                }
-                catch (const std::exception& e) {
-                    std::cerr << "DMX Warning: sACN UpdateLevels exception on universe "
-                              << snap.universe << ": " << e.what() << std::endl;
-                    any_failed = true;
-                }
+
+        // Synchronous mode: scheduled frames go out in order once ChucK time reaches them
+        if (_vm) transmit_due_frames(false, _api->vm->now(_vm));
+        transmit();
+    }
+
+    // Queue the current working frames of all universes for transmission at
+    // ChucK time `when`. Fades are advanced first, as in send(). Nothing is
+    // published before `when`: the queued frame takes over the working frames'
+    // pending changes, so a send() in the meantime doesn't publish them early.
+    void sendAt(t_CKTIME when) {
+        if (!_vm) return;
+        update_fades();
+
+        t_CKTIME now = _api->vm->now(_vm);
+        double srate = static_cast<double>(_api->vm->srate(_vm));
+        auto wall_delay = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+            std::chrono::duration<double>(when > now ? (when - now) / srate : 0.0));
+
+        bool async_mode;
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
+            ScheduledFrame f;
+            if (!_frame_pool.empty()) {
+                f = std::move(_frame_pool.back());
+                _frame_pool.pop_back();
             }
-            if (any_failed && can_attempt_reconnect()) {
-                std::vector<int> uni_keys;
-                for (auto& snap : snapshots)
-                    uni_keys.push_back(snap.universe);
-                std::lock_guard<std::mutex> lock(state_mutex);
-                deinit_sACN();
-                if (init_sACN(uni_keys))
-                    std::cerr << "DMX Info: sACN reinitialized." << std::endl;
-                else
-                    std::cerr << "DMX Warning: sACN reconnect failed." << std::endl;
+            f.due = when;
+            f.due_wall = std::chrono::steady_clock::now() + wall_delay;
+            if (f.data.capacity() < _universes.size() * 512) note_allocation();
+            if (f.universes.capacity() < _universes.size()) note_allocation();
+            f.universes.clear();
+            f.data.resize(_universes.size() * 512);
+            for (size_t i = 0; i < _universes.size(); i++) {
+                f.universes.push_back(_universes[i].universe);
+                memcpy(f.data.data() + i * 512, _universes[i].dmx_data + 1, 512);
+                _universes[i].dirty = false;
             }
-            break;
+            // Timestamp order; equal times keep call order
+            auto pos = std::upper_bound(_scheduled.begin(), _scheduled.end(), when,
+                [](t_CKTIME t, const ScheduledFrame& e) { return t < e.due; });
+            size_t cap = _scheduled.capacity();
+            _scheduled.insert(pos, std::move(f));
+            if (_scheduled.capacity() != cap) note_allocation();
+            _schedule_changed = true;
+            async_mode = _output_running.load();
         }
-        case Protocol::ArtNet: {
-            bool any_failed = false;
-            for (auto& snap : snapshots) {
-                int port_idx = -1;
-                for (int i = 0; i < artnet_snap_count; i++) {
-                    if (artnet_snap[i].universe == snap.universe) {
-                        port_idx = artnet_snap[i].port_idx;
-                        break;
-                    }
-                }
-                if (port_idx < 0) continue;
-                int res = artnet_send_dmx(artnet_node_obj, port_idx, 512, snap.data + 1);
-                if (res < 0) any_failed = true;
-            }
-            if (any_failed) {
-                std::cerr << "DMX Warning: libartnet failed to send DMX." << std::endl;
-                if (can_attempt_reconnect()) {
-                    std::vector<int> uni_keys;
-                    for (auto& snap : snapshots)
-                        uni_keys.push_back(snap.universe);
-                    std::lock_guard<std::mutex> lock(state_mutex);
-                    deinit_ArtNet();
-                    if (init_ArtNet(uni_keys))
-                        std::cerr << "DMX Info: ArtNet reinitialized." << std::endl;
-                    else
-                        std::cerr << "DMX Warning: ArtNet reconnect failed." << std::endl;
-                }
-            }
-            break;
+        if (async_mode) output_cv.notify_one();
+        else if (when <= now) transmit_due_frames(false, now);
+    }
+
+    // Number of heap allocations made by this instance (see _allocations)
+    uint64_t allocations() const {
+        return _allocations.load(std::memory_order_relaxed);
+    }
+
+    int scheduledCount() {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        return static_cast<int>(_scheduled.size());
+    }
+
+    // Drops the queued frames unsent. Their universes' pending changes go back
+    // to the working frames, so the next send() publishes them.
+    void clearScheduled() {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        if (_frame_pool.capacity() < _frame_pool.size() + _scheduled.size()) note_allocation();
+        for (auto& f : _scheduled) {
+            for (int uni : f.universes)
+                if (UniverseData* udata = find_universe(uni)) udata->dirty = true;
+            _frame_pool.push_back(std::move(f));
         }
+        _scheduled.clear();
+        _schedule_changed = true;
+    }
+
+    Clock clock() { return _clock; }
+    bool clock(Clock c) {
+        if (c == Clock::ChucK && !_vm) {
+            std::cerr << "DMX Warning: clock() ChucK time is not available, keeping the system clock." << std::endl;
+            return false;
         }
+        // Keep the fade clock continuous so running fades don't jump
+        int64_t current = clock_raw_ms(_clock) + _fade_clock_offset;
+        _fade_clock_offset = current - clock_raw_ms(c);
+        _clock = c;
+        return true;
     }
 
     bool connected() {
@@ -443,6 +1818,112 @@ public:
     void debug(int enable) { _debug = (enable != 0); }
     int debug() { return _debug ? 1 : 0; }
 
+    bool async() {
+        return _output_running.load();
+    }
+    void async(bool enable) {
+        if (enable) start_output_thread();
+        else stop_output_thread();
+    }
+
+    int minSlots() { return _min_slots; }
+    bool minSlots(int n) {
+        if (n < 1 || n > 512) {
+            std::cerr << "DMX Warning: minSlots() must be 1-512, got " << n << "." << std::endl;
+            return false;
+        }
+        _min_slots = static_cast<uint16_t>(n);
+        // Republish so the new length reaches the wire
+        for (auto& udata : _universes) udata.dirty = true;
+        return true;
+    }
+
+    int breakMode() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        // A writer may have fallen back to BREAK_IOCTL
+        auto mode = _serial_outputs.empty() ? _break_mode : _serial_outputs.front().writer->breakMode();
+        return mode == SerialWriter::BreakMode::Baud ? 1 : 0;
+    }
+    bool breakMode(int mode) {
+        if (mode != 0 && mode != 1) {
+            std::cerr << "DMX Warning: breakMode() must be DMX.BREAK_IOCTL or DMX.BREAK_BAUD, got " << mode << "." << std::endl;
+            return false;
+        }
+#ifndef DMX_HAVE_TERMIOS2
+        if (mode == 1) {
+            std::cerr << "DMX Warning: BREAK_BAUD needs Linux termios2; keeping BREAK_IOCTL." << std::endl;
+            return false;
+        }
+#endif
+        std::lock_guard<std::mutex> slock(send_mutex);
+        _break_mode = mode == 1 ? SerialWriter::BreakMode::Baud : SerialWriter::BreakMode::Ioctl;
+        for (auto& out : _serial_outputs)
+            out.writer->breakMode(_break_mode);
+        return true;
+    }
+
+    // Serial frame pacing: each port's writer starts frames on its own
+    // fixed-rate grid (0 Hz = whenever send() delivers one) and at least
+    // minGapUs apart; calls in between coalesce into the newest frame.
+    double pacing() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        return _pacing.rate_hz;
+    }
+    int pacingGap() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        return _pacing.min_gap_us;
+    }
+    bool pacing(double hz, int minGapUs) {
+        if (!(hz == 0 || (hz >= MIN_REFRESH_HZ && hz <= MAX_REFRESH_HZ)) || minGapUs < 0 || minGapUs > 1000000) {
+            std::cerr << "DMX Warning: pacing() needs 0 or " << MIN_REFRESH_HZ << "-" << MAX_REFRESH_HZ
+                      << " Hz and a gap of 0-1000000 us, got " << hz << ", " << minGapUs << "." << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> slock(send_mutex);
+        _pacing = { hz, minGapUs };
+        for (auto& out : _serial_outputs)
+            out.writer->pacing(_pacing);
+        return true;
+    }
+
+    // Achieved serial frame rate over the last second: the slowest port's
+    // when several are mapped, 0 while output is idle
+    double pacedRate() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        double rate = 0;
+        for (size_t i = 0; i < _serial_outputs.size(); i++) {
+            double r = _serial_outputs[i].writer->pacingStats().rate_hz;
+            rate = i == 0 ? r : std::min(rate, r);
+        }
+        return rate;
+    }
+    // Mean lateness of paced frame starts over the last second (us), worst port
+    double pacingJitter() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        double jitter = 0;
+        for (auto& out : _serial_outputs)
+            jitter = std::max(jitter, out.writer->pacingStats().jitter_us);
+        return jitter;
+    }
+
+    double refreshRate() {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        return _refresh_hz;
+    }
+    bool refreshRate(double hz) {
+        if (!(hz >= MIN_REFRESH_HZ && hz <= MAX_REFRESH_HZ)) {
+            std::cerr << "DMX Warning: refreshRate() must be " << MIN_REFRESH_HZ << "-"
+                      << MAX_REFRESH_HZ << " Hz, got " << hz << "." << std::endl;
+            return false;
+        }
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
+            _refresh_hz = hz;
+        }
+        output_cv.notify_one();
+        return true;
+    }
+
     std::string port() {
         std::lock_guard<std::mutex> lock(state_mutex);
         return serial_port;
@@ -452,79 +1933,188 @@ public:
         serial_port = p;
     }
 
+    // Port a universe is mapped to, or "" if unmapped
+    std::string port(int uni) {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        for (auto& route : _serial_routes)
+            if (route.universe == uni) return route.port;
+        return "";
+    }
+    // Maps a universe to output 1 or 2 of a serial port ("" unmaps). Once any
+    // universe is mapped, serial output sends every mapped universe on its port
+    // and port() / the active universe no longer apply. Output 2 is the second
+    // universe of an Enttec Pro Mk2-style widget (see port2Label()). Takes
+    // effect immediately if serial output is running.
+    bool port(int uni, const std::string& p, int output = 1) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
+            std::cerr << "DMX Warning: port() universe must be 1-63999, got " << uni << "." << std::endl;
+            return false;
+        }
+        if (output < 1 || output > SerialWriter::OUTPUTS) {
+            std::cerr << "DMX Warning: port() output must be 1 or 2, got " << output << "." << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> slock(send_mutex);
+        if (!p.empty() && !find_universe(uni)) create_universe(uni);
+        std::lock_guard<std::mutex> lock(state_mutex);
+        for (auto it = _serial_routes.begin(); it != _serial_routes.end();) {
+            bool same_output = it->port == p && it->output == output - 1;
+            if (it->universe != uni && !same_output) { ++it; continue; }
+            if (it->universe != uni)
+                std::cerr << "DMX Warning: port " << p << " output " << output << " moves from universe "
+                          << it->universe << " to universe " << uni << "." << std::endl;
+            it = _serial_routes.erase(it);
+        }
+        if (!p.empty()) {
+            auto pos = std::upper_bound(_serial_routes.begin(), _serial_routes.end(), uni,
+                [](int u, const SerialRoute& r) { return u < r.universe; });
+            size_t cap = _serial_routes.capacity();
+            _serial_routes.insert(pos, SerialRoute{ uni, p, output - 1 });
+            if (_serial_routes.capacity() != cap) note_allocation();
+        }
+        if (!_serial_outputs.empty())
+            _serial_initialized = sync_serial_outputs();
+        return true;
+    }
+
+    // Enttec widget timing (label 4), sent to every Enttec-framed port now and
+    // after each reconnect. Microseconds are rounded to the widget's 10.67 us steps.
+    bool widgetParams(int breakUs, int mabUs, int rate) {
+        if (breakUs < 96 || breakUs > 1355 || mabUs < 11 || mabUs > 1355 || rate < 0 || rate > 40) {
+            std::cerr << "DMX Warning: widgetParams() needs break 96-1355 us, MAB 11-1355 us and "
+                      << "rate 0-40, got " << breakUs << ", " << mabUs << ", " << rate << "." << std::endl;
+            return false;
+        }
+        auto units = [](int us, int lo) {
+            return static_cast<uint8_t>(std::min(127, std::max(lo, (us * 3 + 16) / 32))); // us / 10.67
+        };
+        std::lock_guard<std::mutex> slock(send_mutex);
+        _widget_params = { units(breakUs, 9), units(mabUs, 1), static_cast<uint8_t>(rate) };
+        _has_widget_params = true;
+        for (auto& out : _serial_outputs)
+            out.writer->widgetParams(_widget_params);
+        return true;
+    }
+
+    // Label the widget expects for output 2 frames. Pro Mk2-style firmware
+    // assigns it once its API key is set; 0 (default) leaves output 2 unused.
+    int port2Label() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        return _port2_label;
+    }
+    bool port2Label(int label) {
+        if (label < 0 || label > 255) {
+            std::cerr << "DMX Warning: port2Label() must be 0-255, got " << label << "." << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> slock(send_mutex);
+        _port2_label = static_cast<uint8_t>(label);
+        for (auto& out : _serial_outputs)
+            out.writer->port2Label(_port2_label);
+        return true;
+    }
+
+    // Starts DMX input from a serial interface ("" stops it). SERIAL decodes
+    // Enttec "received DMX" messages, SERIAL_RAW splits the line at breaks.
+    bool input(const std::string& p, Protocol framing) {
+        if (framing != Protocol::Serial && framing != Protocol::Serial_Raw) {
+            std::cerr << "DMX Warning: input() framing must be DMX.SERIAL or DMX.SERIAL_RAW." << std::endl;
+            return false;
+        }
+#ifdef _WIN32
+        if (framing == Protocol::Serial_Raw) {
+            std::cerr << "DMX Warning: SERIAL_RAW input needs in-band break reporting, which Windows lacks." << std::endl;
+            return false;
+        }
+#endif
+        _input.reset();
+        if (p.empty()) return true;
+        input_event(); // created before the reader thread can signal it
+        auto f = framing == Protocol::Serial_Raw ? SerialWriter::Framing::Raw : SerialWriter::Framing::Enttec;
+        _input.reset(new SerialReader(p, f, [this] { signal_input(); }));
+        return _input->start();
+    }
+    std::string input() { return _input ? _input->port() : std::string(); }
+
+    // Latest received level of a channel (0 before any input or beyond the frame)
+    int inputChannel(int ch) {
+        if (ch < 1 || ch > 512 || !_input) return 0;
+        const SerialReader::InputFrame* f = _input->latest();
+        return f && ch <= f->slots ? f->data[ch] : 0;
+    }
+    // Latest received frame (start code + levels), or nullptr
+    const SerialReader::InputFrame* inputFrame() {
+        return _input ? _input->latest() : nullptr;
+    }
+    uint64_t inputCount() { return _input ? _input->framesReceived() : 0; }
+
+    // Event broadcast on the VM whenever a frame with new levels arrives
+    Chuck_Object* input_event() {
+        if (!_input_event && _vm) {
+            _input_event = _api->object->create_without_shred(_vm, _api->type->lookup(_vm, "Event"), TRUE);
+            _input_event_buffer = _api->vm->create_event_buffer(_vm);
+        }
+        return _input_event;
+    }
+
     static std::string ports() {
-        std::vector<serial::PortInfo> ports = serial::list_ports();
-        std::string result;
-        for (size_t i = 0; i < ports.size(); i++) {
-            if (i > 0) result += ",";
-            result += ports[i].port;
+        return PortWatcher::instance().ports();
+    }
+
+    // Event broadcast on the VM whenever a serial device appears or disappears
+    Chuck_Object* ports_event() {
+        if (!_ports_event && _vm) {
+            _ports_event = _api->object->create_without_shred(_vm, _api->type->lookup(_vm, "Event"), TRUE);
+            _ports_event_buffer = _api->vm->create_event_buffer(_vm);
+            PortWatcher::instance().subscribe(this, [this] {
+                _api->vm->queue_event(_vm, reinterpret_cast<Chuck_Event*>(_ports_event), 1, _ports_event_buffer);
+            });
         }
-        return result;
+        return _ports_event;
     }
 
     int universe() {
         return _active_universe;
     }
     bool universe(int u) {
-        if (u < 1 || u > 63999) {
+        if (u < MIN_UNIVERSE || u > MAX_UNIVERSE) {
             std::cerr << "DMX Warning: universe() must be 1-63999, got " << u << "." << std::endl;
             return false;
         }
         // Auto-create universe data if it doesn't exist
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            if (_universes.find(u) == _universes.end()) {
-                if (static_cast<int>(_universes.size()) >= MAX_UNIVERSES) {
-                    std::cerr << "DMX Warning: Maximum of " << MAX_UNIVERSES << " universes reached." << std::endl;
-                    return false;
-                }
-                _universes[u]; // default construct
-            }
+        if (!find_universe(u)) {
+            std::lock_guard<std::mutex> slock(send_mutex);
+            create_universe(u);
         }
         _active_universe = u;
         return true;
     }
 
     bool addUniverse(int uni) {
-        if (uni < 1 || uni > 63999) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
             std::cerr << "DMX Warning: addUniverse() must be 1-63999, got " << uni << "." << std::endl;
             return false;
         }
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            if (_universes.count(uni)) return true; // already exists
-            if (static_cast<int>(_universes.size()) >= MAX_UNIVERSES) {
-                std::cerr << "DMX Warning: Maximum of " << MAX_UNIVERSES << " universes reached." << std::endl;
-                return false;
-            }
-            _universes[uni]; // create
-        }
+        if (find_universe(uni)) return true; // already exists
+        // Structure changes exclude the transmitter (send_mutex)
+        std::lock_guard<std::mutex> slock(send_mutex);
+        create_universe(uni);
         // If sACN is already running, add the universe live
-        bool sacn_failed = false;
-        {
-            std::lock_guard<std::mutex> slock(send_mutex);
-            std::lock_guard<std::mutex> lock(state_mutex);
-            if (_sacn_initialized) {
-                sacn::Source::UniverseSettings settings{ static_cast<uint16_t>(uni) };
-                settings.priority = static_cast<uint8_t>(_sacn_priority);
-                etcpal::Error err = source.AddUniverse(settings);
-                if (!err.IsOk()) {
-                    std::cerr << "DMX Warning: sACN AddUniverse(" << uni << ") failed: " << err.ToString() << std::endl;
-                    sacn_failed = true;
-                }
-            }
-            if (_artnet_initialized) {
-                std::cerr << "DMX Warning: ArtNet requires re-initialization to add universes. Call init() again." << std::endl;
+        std::lock_guard<std::mutex> lock(state_mutex);
+        if (_sacn_initialized) {
+            sacn::Source::UniverseSettings settings{ static_cast<uint16_t>(uni) };
+            settings.priority = static_cast<uint8_t>(_sacn_priority);
+            etcpal::Error err = source.AddUniverse(settings);
+            if (!err.IsOk()) {
+                std::cerr << "DMX Warning: sACN AddUniverse(" << uni << ") failed: " << err.ToString() << std::endl;
+                // Roll back the arena slot
+                destroy_universe(uni);
+                return false;
             }
         }
-        // On sACN failure, roll back the map entry (respecting lock ordering)
-        if (sacn_failed) {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            _universes.erase(uni);
-            return false;
+        if (_artnet_initialized && uni > ARTNET_MAX_UNIVERSE) {
+            std::cerr << "DMX Warning: ArtNet universe " << uni << " is beyond the last Port-Address (32767) "
+                      << "and is not sent." << std::endl;
         }
         return true;
     }
@@ -533,49 +2123,37 @@ public:
     // If the universe does not exist, returns true (no-op).
     // Cannot remove the last remaining universe.
     bool removeUniverse(int uni) {
-        {
-            std::lock_guard<std::mutex> flock(fade_mutex);
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            auto it = _universes.find(uni);
-            if (it == _universes.end()) return true; // doesn't exist, no-op
-            if (_universes.size() <= 1) {
-                std::cerr << "DMX Warning: Cannot remove the last universe." << std::endl;
-                return false;
-            }
-            _universes.erase(it);
-            // If we removed the active universe, switch to the first remaining
-            if (_active_universe == uni)
-                _active_universe = _universes.begin()->first;
+        if (!find_universe(uni)) return true; // doesn't exist, no-op
+        if (_universes.size() <= 1) {
+            std::cerr << "DMX Warning: Cannot remove the last universe." << std::endl;
+            return false;
         }
-        // If protocols are running, remove from live source
+        // Structure changes exclude the transmitter (send_mutex)
         std::lock_guard<std::mutex> slock(send_mutex);
+        destroy_universe(uni);
+        // If we removed the active universe, switch to the lowest remaining
+        if (_active_universe == uni) {
+            int lowest = MAX_UNIVERSE;
+            for (auto& udata : _universes)
+                lowest = std::min(lowest, udata.universe);
+            _active_universe = lowest;
+        }
+        // If protocols are running, remove from live source
         std::lock_guard<std::mutex> lock(state_mutex);
         if (_sacn_initialized) {
             source.RemoveUniverse(static_cast<uint16_t>(uni));
         }
-        if (_artnet_initialized) {
-            for (int i = 0; i < _artnet_mapping_count; i++) {
-                if (_artnet_mappings[i].universe == uni) {
-                    for (int j = i; j < _artnet_mapping_count - 1; j++)
-                        _artnet_mappings[j] = _artnet_mappings[j + 1];
-                    _artnet_mapping_count--;
-                    break;
-                }
-            }
-        }
         return true;
     }
 
     int universeCount() {
-        std::lock_guard<std::mutex> lock(dmx_mutex);
         return static_cast<int>(_universes.size());
     }
 
     std::string universes() {
-        std::lock_guard<std::mutex> lock(dmx_mutex);
         std::string result;
         bool first = true;
-        for (auto& [uni, udata] : _universes) {
+        for (int uni : _universe_keys) {
             if (!first) result += ",";
             result += std::to_string(uni);
             first = false;
@@ -592,18 +2170,12 @@ public:
             std::cerr << "DMX Warning: priority() must be 0-200, got " << p << "." << std::endl;
             return false;
         }
-        // Get universe keys before acquiring state_mutex (lock ordering)
-        std::vector<int> uni_keys;
-        {
-            std::lock_guard<std::mutex> lock(dmx_mutex);
-            for (auto& [k, v] : _universes)
-                uni_keys.push_back(k);
-        }
         std::lock_guard<std::mutex> slock(send_mutex);
         std::lock_guard<std::mutex> lock(state_mutex);
         // If sACN is already running, update priority on all universes first
         if (_sacn_initialized) {
-            for (int uni : uni_keys) {
+            for (auto& udata : _universes) {
+                int uni = udata.universe;
                 etcpal::Error err = source.ChangePriority(static_cast<uint16_t>(uni), static_cast<uint8_t>(p));
                 if (!err.IsOk()) {
                     std::cerr << "DMX Warning: Failed to change sACN priority on universe "
@@ -617,6 +2189,44 @@ public:
         return true;
     }
 
+    bool artnetSync() {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return _artnet_sync;
+    }
+    bool artnetSync(bool enable) {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        _artnet_sync = enable;
+        return enable;
+    }
+
+    int artnetUnicast() {
+        std::lock_guard<std::mutex> lock(state_mutex);
+        return _artnet_unicast;
+    }
+    bool artnetUnicast(int limit) {
+        if (limit < 0 || limit > MAX_ARTNET_UNICAST) {
+            std::cerr << "DMX Warning: artnetUnicast() must be 0-" << MAX_ARTNET_UNICAST
+                      << ", got " << limit << "." << std::endl;
+            return false;
+        }
+        std::lock_guard<std::mutex> slock(send_mutex);
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            _artnet_unicast = limit;
+        }
+        std::lock_guard<std::mutex> alock(artnet_mutex);
+        if (artnet_node_obj) artnet_set_bcast_limit(artnet_node_obj, limit);
+        return true;
+    }
+
+    // Nodes that answered the last polls; 0 when ArtNet is not running
+    int artnetNodes() {
+        std::lock_guard<std::mutex> slock(send_mutex);
+        std::lock_guard<std::mutex> alock(artnet_mutex);
+        if (!artnet_node_obj) return 0;
+        return artnet_nl_get_length(artnet_get_nl(artnet_node_obj));
+    }
+
     std::string name() {
         std::lock_guard<std::mutex> lock(state_mutex);
         return _source_name;
@@ -652,25 +2262,13 @@ public:
             return;
         }
 
-        int uni = _active_universe;
-        std::lock_guard<std::mutex> flock(fade_mutex);
-        auto it = _universes.find(uni);
-        if (it == _universes.end()) return;
-        UniverseData& udata = it->second;
-        FadeState& f = udata.fades[ch];
-        {
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            f.start_value = udata.dmx_data[ch];
-        }
-        f.target_value = static_cast<unsigned char>(target);
-        f.start_time = std::chrono::steady_clock::now();
-        f.duration = std::chrono::milliseconds(durationMs);
-        if (!f.active) udata.active_fade_count++;
-        f.active = true;
+        UniverseData* udata = find_universe(_active_universe);
+        if (!udata) return;
+        start_fade(*udata, ch, target, durationMs);
     }
 
     void fade(int uni, int ch, int target, int durationMs) {
-        if (uni < 1 || uni > 63999) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
             std::cerr << "DMX Warning: fade() universe " << uni << " out of range (1-63999), ignored." << std::endl;
             return;
         }
@@ -684,39 +2282,71 @@ public:
             return;
         }
 
-        std::lock_guard<std::mutex> flock(fade_mutex);
-        auto it = _universes.find(uni);
-        if (it == _universes.end()) return;
-        UniverseData& udata = it->second;
-        FadeState& f = udata.fades[ch];
-        {
-            std::lock_guard<std::mutex> dlock(dmx_mutex);
-            f.start_value = udata.dmx_data[ch];
+        UniverseData* udata = find_universe(uni);
+        if (!udata) return;
+        start_fade(*udata, ch, target, durationMs);
+    }
+
+    // Crossfade a whole universe to `count` target levels (channels 1..count);
+    // channels past count keep their current level. Replaces running fades.
+    void crossfade(int uni, const unsigned char* target, int count, int durationMs) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) {
+            std::cerr << "DMX Warning: crossfade() universe " << uni << " out of range (1-63999), ignored." << std::endl;
+            return;
+        }
+        UniverseData* udata = find_universe(uni);
+        if (!udata) {
+            std::cerr << "DMX Warning: crossfade() universe " << uni << " does not exist, ignored." << std::endl;
+            return;
+        }
+        if (count > 512) count = 512;
+        if (count < 0) count = 0;
+
+        if (udata->fades) udata->fades->clear();
+        if (durationMs <= 0) {
+            if (udata->xfade) udata->xfade->active = false;
+            for (int ch = 1; ch <= count; ch++) udata->set(ch, target[ch - 1]);
+            return;
+        }
+
+        if (!udata->xfade) {
+            udata->xfade.reset(new Crossfade());
+            note_allocation();
         }
-        f.target_value = static_cast<unsigned char>(target);
-        f.start_time = std::chrono::steady_clock::now();
-        f.duration = std::chrono::milliseconds(durationMs);
-        if (!f.active) udata.active_fade_count++;
-        f.active = true;
+        track_fading(*udata);
+        Crossfade& x = *udata->xfade;
+        memcpy(x.from, udata->dmx_data + 1, 512);
+        memcpy(x.to, x.from, 512);
+        memcpy(x.to, target, count);
+        x.start_ms = fade_now_ms();
+        x.duration_ms = static_cast<uint32_t>(durationMs);
+        x.last_weight = 0;
+        x.active = true;
+        udata->use_slots(count);
     }
 
 private:
     Protocol _protocol{ Protocol::Serial };
     std::string _source_name{ "ChucK DMX" };
     int _sacn_priority{ 100 };
-
-    // Multi-universe data: maps universe number -> per-universe DMX + fade state
-    // Protected by fade_mutex (fades) and dmx_mutex (dmx_data); map structure
-    // modifications require both locks (fade_mutex then dmx_mutex)
-    std::map<int, UniverseData> _universes;
-    int _active_universe{ 1 };
-
-    // Lock ordering: fade_mutex -> dmx_mutex -> state_mutex
-    // send_mutex -> state_mutex (serializes protocol I/O; never held with fade/dmx)
-    std::mutex dmx_mutex;     // protects dmx_data within _universes
+    bool _artnet_sync{ false };  // follow each batch of ArtDmx packets with an ArtSync
+    int _artnet_unicast{ DEFAULT_ARTNET_UNICAST };
+
+    // Multi-universe data: a contiguous arena of per-universe DMX + fade state,
+    // plus a dense index from universe number (1-63999) to arena slot.
+    // dmx_data and fades are owned by the ChucK VM thread (the only writer) and
+    // need no lock; the transmitter reads published frames via each universe's
+    // TripleBuffer. Arena/index modifications happen on the VM thread under
+    // send_mutex so they never race the transmitter's iteration.
+    std::vector<UniverseData> _universes;
+    std::vector<uint16_t> _slot_index;
+    std::vector<int> _universe_keys;          // ascending universe numbers, kept with the arena
+    std::atomic<int> _active_universe{ 1 };
+
+    // Lock ordering: send_mutex -> state_mutex
     std::mutex state_mutex;   // protects protocol, init state, source name
-    std::mutex fade_mutex;    // protects fades within _universes
     std::mutex send_mutex;    // serializes protocol I/O (sACN/ArtNet are not thread-safe)
+                              // and _universes structure changes
 
     // Initialization tracking
     bool _serial_initialized{ false };
@@ -726,92 +2356,532 @@ private:
     // Debug output
     bool _debug{ false };
 
+    // Serial frames carry max(minSlots, highest channel used) slots (VM thread)
+    uint16_t _min_slots{ 512 };
+
+    // Async output thread: send() publishes each universe's frame buffer, the
+    // thread retransmits the latest published frames at _refresh_hz
+    // Lock ordering: output_mutex is a leaf; never held while acquiring other locks
+    std::thread _output_thread;
+    std::mutex output_mutex;              // protects _output_stop, _refresh_hz, scheduled frames
+    std::condition_variable output_cv;
+    std::atomic<bool> _output_running{ false };
+    std::atomic<bool> _frame_published{ false };
+    bool _output_stop{ false };
+    double _refresh_hz{ DEFAULT_REFRESH_HZ };
+
+    // Scheduled frames (sendAt), sorted by due time; also under output_mutex.
+    // Spent entries go back to _frame_pool to reuse their buffers.
+    std::vector<ScheduledFrame> _scheduled;
+    std::vector<ScheduledFrame> _frame_pool;
+    bool _schedule_changed{ false };
+
+    // Fades: universes with a non-empty FadeList (may hold stale entries, pruned
+    // by update_fades) and the origin of the millisecond fade clock
+    std::vector<int> _fading_universes;      // reserved to the arena's capacity
+    std::chrono::steady_clock::time_point _fade_epoch{ std::chrono::steady_clock::now() };
+
+    // Fade time base: wall clock or ChucK logical time. The offset keeps the
+    // millisecond clock continuous across clock() switches.
+    Chuck_VM* _vm{ nullptr };
+    CK_DL_API _api{ nullptr };
+
+    // Serial input (VM thread). The reader thread queues _input_event on the
+    // VM, which broadcasts it, so shreds wait on it instead of polling.
+    std::unique_ptr<SerialReader> _input;
+    Chuck_Object* _input_event{ nullptr };
+    CBufferSimple* _input_event_buffer{ nullptr };
+    Chuck_Object* _ports_event{ nullptr };      // hotplug, queued by the PortWatcher thread
+    CBufferSimple* _ports_event_buffer{ nullptr };
+
+    void signal_input() {
+        if (_input_event && _input_event_buffer)
+            _api->vm->queue_event(_vm, reinterpret_cast<Chuck_Event*>(_input_event), 1, _input_event_buffer);
+    }
+    Clock _clock{ Clock::System };
+    int64_t _fade_clock_offset{ 0 };
+
+    // Heap allocations made by this instance's own containers (arena growth,
+    // fade/crossfade state, sendAt buffers); flat while the setup is stable
+    std::atomic<uint64_t> _allocations{ 0 };
+
     // Reconnect backoff tracking
     int64_t _last_reconnect_ticks{ 0 };
 
-    // Serial
-    serial::Serial serial_obj;
+    // Serial: one writer per port, each owning its port and thread, so every
+    // port transmits in parallel. Without a universe map a single writer on
+    // serial_port carries the active universe.
+    struct SerialRoute {
+        int universe;
+        std::string port;
+        int output;                             // 0-based writer output
+    };
+    struct SerialOutput {
+        int universe[SerialWriter::OUTPUTS]{};  // 0 = unused
+        bool follow_active{ false };            // no map: output 0 carries the active universe
+        int sent_universe[SerialWriter::OUTPUTS]{}; // universe last submitted (transmitter only)
+        std::unique_ptr<SerialWriter> writer;
+    };
+    std::vector<SerialOutput> _serial_outputs;  // replaced under send_mutex
+    std::vector<SerialRoute> _serial_routes;    // sorted by universe; under state_mutex
+    SerialWriter::BreakMode _break_mode{ SerialWriter::BreakMode::Ioctl }; // under send_mutex
+    SerialWriter::Pacing _pacing{ 0, 0 };                                  // under send_mutex
+    SerialWriter::WidgetParams _widget_params{};                           // under send_mutex
+    bool _has_widget_params{ false };
+    uint8_t _port2_label{ 0 };
     std::string serial_port;
-    std::mutex serial_mutex; // protects serial_obj
 
     // sACN
     sacn::Source source;
 
-    // ArtNet
-    artnet_node artnet_node_obj = nullptr;
-    ArtNetMapping _artnet_mappings[ARTNET_MAX_PORTS]{};
-    int _artnet_mapping_count{ 0 };
+    // ArtNet. The node is created and destroyed under send_mutex; artnet_mutex
+    // (a leaf) serializes the transmitter's sends with the reader thread, which
+    // answers ArtPoll, polls the network and keeps the node list for unicast.
+    artnet_node artnet_node_obj = nullptr;
+    std::mutex artnet_mutex;
+    std::thread _artnet_reader;
+    std::atomic<bool> _artnet_reader_stop{ false };
+
+    // O(1) universe lookup through the dense index
+    UniverseData* find_universe(int uni) {
+        if (uni < MIN_UNIVERSE || uni > MAX_UNIVERSE) return nullptr;
+        uint16_t slot = _slot_index[uni];
+        return slot == NO_SLOT ? nullptr : &_universes[slot];
+    }
+
+    // Arena maintenance (VM thread, under send_mutex once the transmitter may be running)
+    // The arena and everything sized by it only grow here, so send() and the
+    // transmitter never allocate once the universe set is stable
+    void create_universe(int uni) {
+        size_t cap = _universes.capacity();
+        _slot_index[uni] = static_cast<uint16_t>(_universes.size());
+        _universes.emplace_back(uni);
+        if (_universes.capacity() != cap) note_allocation();
+
+        cap = _universe_keys.capacity();
+        _universe_keys.insert(std::lower_bound(_universe_keys.begin(), _universe_keys.end(), uni), uni);
+        if (_universe_keys.capacity() != cap) note_allocation();
+
+        if (_fading_universes.capacity() < _universes.size()) {
+            _fading_universes.reserve(_universes.capacity());
+            note_allocation();
+        }
+    }
+
+    void destroy_universe(int uni) {
+        uint16_t slot = _slot_index[uni];
+        if (slot == NO_SLOT) return;
+        // Drop it from the fading list now: a universe re-added under the same
+        // number starts unlisted, so a stale entry would list it twice
+        if (_universes[slot].fading_listed) {
+            auto it = std::find(_fading_universes.begin(), _fading_universes.end(), uni);
+            if (it != _fading_universes.end()) {
+                *it = _fading_universes.back();
+                _fading_universes.pop_back();
+            }
+        }
+        // Swap-remove keeps the arena dense; fix up the moved slot's index entry
+        if (slot != _universes.size() - 1) {
+            _universes[slot] = std::move(_universes.back());
+            _slot_index[_universes[slot].universe] = slot;
+        }
+        _universes.pop_back();
+        _slot_index[uni] = NO_SLOT;
+        _universe_keys.erase(std::lower_bound(_universe_keys.begin(), _universe_keys.end(), uni));
+    }
+
+    void note_allocation() {
+        _allocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Fade clock in milliseconds; wraps after ~49 days, elapsed math is modular
+    uint32_t fade_now_ms() {
+        return static_cast<uint32_t>(clock_raw_ms(_clock) + _fade_clock_offset);
+    }
+
+    // ChucK time is only read from the VM thread (send(), fade(), DMXOut)
+    int64_t clock_raw_ms(Clock c) {
+        if (c == Clock::ChucK && _vm) {
+            double samples = _api->vm->now(_vm);
+            return static_cast<int64_t>(samples * 1000.0 / static_cast<double>(_api->vm->srate(_vm)));
+        }
+        auto elapsed = std::chrono::steady_clock::now() - _fade_epoch;
+        return std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+    }
+
+    void track_fading(UniverseData& udata) {
+        if (udata.fading_listed) return;
+        udata.fading_listed = true;
+        size_t cap = _fading_universes.capacity();
+        _fading_universes.push_back(udata.universe);
+        if (_fading_universes.capacity() != cap) note_allocation();
+    }
+
+    void start_fade(UniverseData& udata, int ch, int target, int durationMs) {
+        if (!udata.has_fade_list()) note_allocation();
+        track_fading(udata);
+        // The per-channel fade steps after the crossfade and owns the channel
+        udata.pin(ch, static_cast<unsigned char>(target));
+        FadeList& list = udata.fade_list();
+        list.start(ch, udata.dmx_data[ch], static_cast<uint8_t>(target), fade_now_ms(),
+                   static_cast<uint32_t>(durationMs));
+    }
+
+    // Advances running fades. Cost scales with the number of active fades:
+    // only universes on _fading_universes are visited, and only their list entries.
+    void update_fades() {
+        if (_fading_universes.empty()) return;
+        uint32_t now = fade_now_ms();
+
+        for (size_t u = 0; u < _fading_universes.size();) {
+            UniverseData* udata = find_universe(_fading_universes[u]);
+            if (!udata || !udata->animating()) {
+                // Universe removed or all its fades finished/cancelled
+                if (udata) udata->fading_listed = false;
+                _fading_universes[u] = _fading_universes.back();
+                _fading_universes.pop_back();
+                continue;
+            }
+            if (udata->crossfading()) step_crossfade(*udata, now);
+            if (udata->active_fade_count() > 0) step_fades(*udata, now);
+            u++;
+        }
+    }
+
+    static void step_crossfade(UniverseData& udata, uint32_t now) {
+        Crossfade& x = *udata.xfade;
+        uint32_t elapsed = now - x.start_ms;
+        if (elapsed >= x.duration_ms) {
+            memcpy(udata.dmx_data + 1, x.to, 512);
+            x.active = false;
+            udata.dirty = true;
+            return;
+        }
+        unsigned w = static_cast<unsigned>((static_cast<uint64_t>(elapsed) << 8) / x.duration_ms);
+        if (w == x.last_weight && w != 0) return; // same blend as last update
+        x.last_weight = w;
+        blend_frame(x.from, x.to, udata.dmx_data + 1, 512, w);
+        udata.dirty = true;
+    }
+
+    static void step_fades(UniverseData& udata, uint32_t now) {
+        FadeList& f = *udata.fades;
+        for (int i = 0; i < f.count;) {
+            uint32_t elapsed = now - f.start_ms[i];
+            if (elapsed >= f.duration_ms[i]) {
+                udata.set(f.channel[i], f.target[i]);
+                f.remove_at(i); // last entry moved into i; revisit it
+                continue;
+            }
+            // |step * elapsed| < |delta| << 32, so the product cannot overflow
+            int32_t level_fx = f.start_fx[i] + static_cast<int32_t>((f.step[i] * elapsed) >> 16);
+            udata.set(f.channel[i], static_cast<unsigned char>((level_fx + 0x8000) >> 16));
+            i++;
+        }
+    }
+
+    // Transmits the newest published frame of every universe over the active protocol.
+    // Called from send() in synchronous mode, or from the output thread in async mode.
+    // A scheduled frame, when given, replaces the newest published frame of its
+    // universes and stays on the wire until the VM publishes a newer one.
+    void transmit(const ScheduledFrame* scheduled = nullptr) {
+        // Serialize protocol I/O — sACN and ArtNet libraries are not thread-safe.
+        // Holding send_mutex also keeps the _universes structure stable.
+        std::lock_guard<std::mutex> slock(send_mutex);
+
+        // State snapshot under state_mutex
+        Protocol current_protocol;
+        bool artnet_sync;
+        {
+            std::lock_guard<std::mutex> lock(state_mutex);
+            current_protocol = _protocol;
+            artnet_sync = _artnet_sync;
+        }
+
+        for (auto& udata : _universes)
+            udata.frames.acquire();
+        if (scheduled) {
+            // The transmitter owns front(); overwrite it and force a resend
+            for (size_t i = 0; i < scheduled->universes.size(); i++) {
+                UniverseData* udata = find_universe(scheduled->universes[i]);
+                if (!udata) continue; // removed since sendAt()
+                memcpy(udata->frames.front().data + 1, scheduled->data.data() + i * 512, 512);
+                // The frame may use channels no published frame has yet; send them all
+                udata->frames.front().slots = 512;
+                udata->sent_generation = NEVER_SENT;
+            }
+        }
+        auto now = std::chrono::steady_clock::now();
+
+        switch (current_protocol) {
+        case Protocol::Serial_Raw:
+        case Protocol::Serial: {
+            // Raw interfaces need the host to regenerate every frame on the wire
+            int keepalive = current_protocol == Protocol::Serial_Raw ? 0 : SERIAL_KEEPALIVE_MS;
+            // Submitting never blocks, so all ports' writers run concurrently
+            // and a pass costs one frame time however many ports there are
+            for (auto& out : _serial_outputs) {
+                for (int o = 0; o < SerialWriter::OUTPUTS; o++) {
+                    int uni = out.universe[o];
+                    if (o == 0 && out.follow_active) uni = _active_universe.load(std::memory_order_relaxed);
+                    UniverseData* udata = uni ? find_universe(uni) : nullptr;
+                    if (!udata) continue;
+                    // A new universe on this output always forces a frame out
+                    if (uni != out.sent_universe[o])
+                        udata->sent_generation = NEVER_SENT;
+                    if (!needs_send(*udata, now, keepalive)) continue;
+                    const Frame& frame = udata->frames.front();
+                    if (send_Serial(out, o, frame.data, frame.slots)) {
+                        mark_sent(*udata, now);
+                        out.sent_universe[o] = uni;
+                    }
+                }
+            }
+            break;
+        }
+        case Protocol::sACN: {
+            bool any_failed = false;
+            for (auto& udata : _universes) {
+                // Skipping unchanged universes lets sACN transmission suppression
+                // kick in: UpdateLevels() always resets it, even for identical data
+                if (!needs_send(udata, now, -1)) continue;
+                try {
+                    source.UpdateLevels(static_cast<uint16_t>(udata.universe), udata.frames.front().data + 1, 512);
+                    mark_sent(udata, now);
+                }
+                catch (const std::exception& e) {
+                    std::cerr << "DMX Warning: sACN UpdateLevels exception on universe "
+                              << udata.universe << ": " << e.what() << std::endl;
+                    any_failed = true;
+                }
+            }
+            if (any_failed && can_attempt_reconnect()) {
+                std::lock_guard<std::mutex> lock(state_mutex);
+                deinit_sACN();
+                mark_all_unsent();
+                if (init_sACN(_universe_keys))
+                    std::cerr << "DMX Info: sACN reinitialized." << std::endl;
+                else
+                    std::cerr << "DMX Warning: sACN reconnect failed." << std::endl;
+            }
+            break;
+        }
+        case Protocol::ArtNet: {
+            // Nothing to send through until init() has started a node (the flags
+            // only change under send_mutex, which is held here)
+            if (!_artnet_initialized || !artnet_node_obj) break;
+            bool any_failed = false;
+            int sent = 0;
+            std::unique_lock<std::mutex> alock(artnet_mutex);
+            // Queue the pass's packets and flush them together: one sendmmsg()
+            // per batch instead of a sendto() per universe (and per unicast node)
+            artnet_batch_begin(artnet_node_obj);
+            for (auto& udata : _universes) {
+                if (udata.universe > ARTNET_MAX_UNIVERSE) continue;
+                if (!needs_send(udata, now, ARTNET_KEEPALIVE_MS)) continue;
+                // Sequence 1-255 per Port-Address; 0 would turn receivers' reordering off
+                udata.artnet_sequence = udata.artnet_sequence == 255 ? 1 : udata.artnet_sequence + 1;
+                int res = artnet_send_dmx_addr(artnet_node_obj, static_cast<uint16_t>(udata.universe - 1),
+                                               udata.artnet_sequence, 512, udata.frames.front().data + 1);
+                if (res < 0) any_failed = true;
+                else {
+                    mark_sent(udata, now);
+                    sent++;
+                }
+            }
+            // One ArtSync per batch: receivers in synchronous mode latch every
+            // universe above and output them together
+            if (artnet_sync && sent > 0 && artnet_send_sync(artnet_node_obj) < 0)
+                any_failed = true;
+            if (artnet_batch_flush(artnet_node_obj) < 0) {
+                any_failed = true;
+                mark_all_unsent(); // queued universes were marked sent; retry them all
+            }
+            alock.unlock(); // deinit_ArtNet() joins the reader, which takes artnet_mutex
+            if (any_failed) {
+                std::cerr << "DMX Warning: libartnet failed to send DMX." << std::endl;
+                if (can_attempt_reconnect()) {
+                    std::lock_guard<std::mutex> lock(state_mutex);
+                    deinit_ArtNet();
+                    mark_all_unsent();
+                    if (init_ArtNet(_universe_keys))
+                        std::cerr << "DMX Info: ArtNet reinitialized." << std::endl;
+                    else
+                        std::cerr << "DMX Warning: ArtNet reconnect failed." << std::endl;
+                }
+            }
+            break;
+        }
+        }
+    }
+
 
-    void update_fades() {
-        auto now = std::chrono::steady_clock::now();
-        std::lock_guard<std::mutex> flock(fade_mutex);
-        std::lock_guard<std::mutex> dlock(dmx_mutex);
-
-        for (auto& [uni, udata] : _universes) {
-            if (udata.active_fade_count == 0) continue;
-
-            for (int ch = 1; ch <= 512; ch++) {
-                FadeState& f = udata.fades[ch];
-                if (!f.active) continue;
-
-                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - f.start_time);
-                if (elapsed >= f.duration) {
-                    udata.dmx_data[ch] = f.target_value;
-                    f.active = false;
-                    udata.active_fade_count--;
-                } else {
-                    double t = static_cast<double>(elapsed.count()) / static_cast<double>(f.duration.count());
-                    int interp = f.start_value + static_cast<int>(t * (static_cast<int>(f.target_value) - static_cast<int>(f.start_value)));
-                    udata.dmx_data[ch] = static_cast<unsigned char>(clamp_dmx(interp));
+    // Transmit every scheduled frame that is due, in timestamp order. The output
+    // thread compares wall-clock due times; synchronous send() compares ChucK time.
+    void transmit_due_frames(bool wall, t_CKTIME chuck_now) {
+        ScheduledFrame f;
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(output_mutex);
+                if (!f.data.empty()) {
+                    size_t cap = _frame_pool.capacity();
+                    _frame_pool.push_back(std::move(f));
+                    if (_frame_pool.capacity() != cap) note_allocation();
                 }
+                if (_scheduled.empty()) return;
+                const ScheduledFrame& next = _scheduled.front();
+                bool due = wall ? next.due_wall <= std::chrono::steady_clock::now() : next.due <= chuck_now;
+                if (!due) return;
+                f = std::move(_scheduled.front());
+                _scheduled.erase(_scheduled.begin());
             }
+            transmit(&f);
         }
     }
 
-    void openPort() {
-        if (serial_obj.isOpen())
-            serial_obj.close();
+    // Change tracking (transmitter side, under send_mutex). keepalive_ms < 0
+    // means unchanged frames are never retransmitted, 0 means always.
+    bool needs_send(const UniverseData& udata, std::chrono::steady_clock::time_point now, int keepalive_ms) {
+        if (udata.frames.front().generation != udata.sent_generation) return true;
+        if (keepalive_ms < 0) return false;
+        return now - udata.last_sent >= std::chrono::milliseconds(keepalive_ms);
+    }
 
-        serial_obj.setPort(serial_port);
-        serial_obj.setBaudrate(250000);
-        serial_obj.setBytesize(serial::eightbits);
-        serial_obj.setParity(serial::parity_none);
-        serial_obj.setStopbits(serial::stopbits_two);
-        serial_obj.setFlowcontrol(serial::flowcontrol_none);
-        serial::Timeout timeout = serial::Timeout::simpleTimeout(1000);
-        serial_obj.setTimeout(timeout);
-        serial_obj.open();
+    void mark_sent(UniverseData& udata, std::chrono::steady_clock::time_point now) {
+        udata.sent_generation = udata.frames.front().generation;
+        udata.last_sent = now;
     }
 
-    void closePort() {
-        try {
-            if (serial_obj.isOpen())
-                serial_obj.close();
+    // Forces every universe out on the next transmit (after (re)initialization)
+    void mark_all_unsent() {
+        for (auto& udata : _universes)
+            udata.sent_generation = NEVER_SENT;
+        for (auto& out : _serial_outputs)
+            for (int& uni : out.sent_universe) uni = 0;
+    }
+
+    void start_output_thread() {
+        std::lock_guard<std::mutex> lock(output_mutex);
+        if (_output_running) return;
+        _output_stop = false;
+        _frame_published = false;
+        _output_running = true;
+        _output_thread = std::thread(&DMX::output_loop, this);
+    }
+
+    void stop_output_thread() {
+        {
+            std::lock_guard<std::mutex> lock(output_mutex);
+            if (!_output_running) return;
+            _output_stop = true;
+        }
+        output_cv.notify_one();
+        if (_output_thread.joinable())
+            _output_thread.join();
+        _output_running = false;
+    }
+
+    // Output thread body: owns all protocol I/O while async mode is enabled.
+    // Retransmits the most recently published frame once per refresh period,
+    // so a stalled transport only ever delays this thread, never the VM.
+    // Scheduled frames wake the thread at their own due times in between.
+    void output_loop() {
+        auto deadline = std::chrono::steady_clock::now();
+        bool refresh_due = true;
+
+        while (true) {
+            {
+                std::unique_lock<std::mutex> lock(output_mutex);
+                auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(1.0 / _refresh_hz));
+                auto now = std::chrono::steady_clock::now();
+                if (refresh_due) {
+                    deadline += period;
+                    // Fell behind (slow transport or rate change): resynchronize instead of bursting
+                    if (deadline < now || deadline > now + period)
+                        deadline = now + period;
+                }
+                auto wake = deadline;
+                if (!_scheduled.empty() && _scheduled.front().due_wall < wake)
+                    wake = _scheduled.front().due_wall;
+                _schedule_changed = false;
+                output_cv.wait_until(lock, wake, [this] { return _output_stop || _schedule_changed; });
+                if (_output_stop) break;
+                refresh_due = std::chrono::steady_clock::now() >= deadline;
+            }
+            transmit_due_frames(true, 0);
+            if (refresh_due && _frame_published.load(std::memory_order_acquire))
+                transmit();
         }
-        catch (...) {}
     }
 
     bool init_Serial() {
-        if (serial_port.empty()) {
+        if (serial_port.empty() && _serial_routes.empty()) {
             std::cerr << "DMX Error: Serial port name not set. Call port() before init()." << std::endl;
             return false;
         }
-        try {
-            std::lock_guard<std::mutex> lock(serial_mutex);
-            openPort();
-            _serial_initialized = true;
-            return true;
-        }
-        catch (const std::exception& e) {
-            std::cerr << "DMX Error: Failed to open serial port: " << e.what() << std::endl;
-            return false;
+        _serial_initialized = sync_serial_outputs();
+        return _serial_initialized;
+    }
+
+    // Brings the writers in line with the port map (under send_mutex and
+    // state_mutex). Writers whose port stays in use keep running; new ports
+    // get a writer that stays up even if the port is missing and reconnects
+    // on later frames. Returns false if any new port failed to open.
+    bool sync_serial_outputs() {
+        bool follow_active = _serial_routes.empty();
+        SerialRoute active_route{ 0, serial_port, 0 };
+        const SerialRoute* routes = follow_active ? &active_route : _serial_routes.data();
+        size_t route_count = follow_active ? 1 : _serial_routes.size();
+        auto framing = _protocol == Protocol::Serial_Raw ? SerialWriter::Framing::Raw
+                                                         : SerialWriter::Framing::Enttec;
+        bool ok = true;
+        std::vector<SerialOutput> next;
+        next.reserve(route_count);
+        for (size_t r = 0; r < route_count; r++) {
+            const SerialRoute& route = routes[r];
+            if (route.output > 0 && framing == SerialWriter::Framing::Raw) {
+                std::cerr << "DMX Warning: SERIAL_RAW has no output 2; universe " << route.universe
+                          << " is not sent." << std::endl;
+                continue;
+            }
+            if (route.output > 0 && _port2_label == 0)
+                std::cerr << "DMX Warning: universe " << route.universe << " is on output 2 of " << route.port
+                          << " but port2Label() is not set; it is not sent." << std::endl;
+            SerialOutput* out = nullptr;
+            for (auto& n : next)
+                if (n.writer->port() == route.port) out = &n;
+            if (!out) {
+                next.emplace_back();
+                out = &next.back();
+                for (auto& old : _serial_outputs) {
+                    if (old.writer && old.writer->port() == route.port) {
+                        out->writer = std::move(old.writer);
+                        break;
+                    }
+                }
+                if (!out->writer) {
+                    out->writer.reset(new SerialWriter(route.port, framing));
+                    note_allocation();
+                    out->writer->breakMode(_break_mode);
+                    out->writer->pacing(_pacing);
+                    out->writer->port2Label(_port2_label);
+                    if (_has_widget_params) out->writer->widgetParams(_widget_params);
+                    ok = out->writer->start() && ok;
+                }
+            }
+            out->universe[route.output] = route.universe;
+            out->follow_active = follow_active;
         }
+        // The table is rebuilt each time; count it only when it outgrows the old one
+        if (next.capacity() > _serial_outputs.capacity()) note_allocation();
+        _serial_outputs = std::move(next); // writers left behind join and close here
+        mark_all_unsent();
+        return ok;
     }
 
     void deinit_Serial() {
-        if (!_serial_initialized) return;
-        std::lock_guard<std::mutex> lock(serial_mutex);
-        closePort();
+        _serial_outputs.clear(); // joins the writer threads and closes the ports
         _serial_initialized = false;
     }
 
@@ -871,9 +2941,10 @@ private:
             std::cerr << "DMX Error: No universes configured for ArtNet." << std::endl;
             return false;
         }
-        if (uni_keys.size() > ARTNET_MAX_PORTS) {
-            std::cerr << "DMX Warning: ArtNet supports at most " << ARTNET_MAX_PORTS << " ports per node. "
-                      << "Only the first " << ARTNET_MAX_PORTS << " universes will be used." << std::endl;
+        for (int uni : uni_keys) {
+            if (uni > ARTNET_MAX_UNIVERSE)
+                std::cerr << "DMX Warning: ArtNet universe " << uni << " is beyond the last Port-Address (32767) "
+                          << "and is not sent." << std::endl;
         }
 
         artnet_node_obj = artnet_new(nullptr, 0);
@@ -884,56 +2955,64 @@ private:
 
         artnet_set_short_name(artnet_node_obj, _source_name.c_str());
         artnet_set_long_name(artnet_node_obj, _source_name.c_str());
-        artnet_set_node_type(artnet_node_obj, ARTNET_NODE);
-
-        // Use subnet from first universe; all ports share the same subnet
-        uint8_t subnet = ((uni_keys[0] - 1) >> 4) & 0x0F;
-        artnet_set_subnet_addr(artnet_node_obj, subnet);
-
-        _artnet_mapping_count = 0;
-        int port_idx = 0;
-        for (int uni : uni_keys) {
-            if (port_idx >= ARTNET_MAX_PORTS) break;
-
-            uint8_t uni_subnet = ((uni - 1) >> 4) & 0x0F;
-            if (uni_subnet != subnet) {
-                std::cerr << "DMX Warning: ArtNet universe " << uni
-                          << " is in a different subnet, skipped. "
-                          << "All universes must share the same ArtNet subnet." << std::endl;
-                continue;
-            }
-
-            uint8_t uni_addr = (uni - 1) & 0x0F;
-            artnet_set_port_type(artnet_node_obj, port_idx, ARTNET_ENABLE_INPUT, ARTNET_PORT_DMX);
-            artnet_set_port_addr(artnet_node_obj, port_idx, ARTNET_INPUT_PORT, uni_addr);
-            _artnet_mappings[_artnet_mapping_count].universe = uni;
-            _artnet_mappings[_artnet_mapping_count].port_idx = port_idx;
-            _artnet_mapping_count++;
-            port_idx++;
-        }
+        // A controller: it answers ArtPoll and may poll for the nodes to unicast to
+        artnet_set_node_type(artnet_node_obj, ARTNET_SRV);
+        artnet_set_bcast_limit(artnet_node_obj, _artnet_unicast);
+        // Frames go out by 15-bit Port-Address (universe - 1 = Net:SubNet:Universe),
+        // not through the node's four ports, so one node drives any number of universes
 
         if (artnet_start(artnet_node_obj) < 0) {
             artnet_destroy(artnet_node_obj);
             artnet_node_obj = nullptr;
-            _artnet_mapping_count = 0;
             std::cerr << "DMX Error: Failed to start libartnet node." << std::endl;
             return false;
         }
 
+        _artnet_reader_stop = false;
+        _artnet_reader = std::thread(&DMX::artnet_reader_loop, this, artnet_node_obj);
         _artnet_initialized = true;
         return true;
     }
 
     void deinit_ArtNet() {
         if (!_artnet_initialized) return;
+        _artnet_reader_stop = true;
+        if (_artnet_reader.joinable())
+            _artnet_reader.join();
         if (artnet_node_obj) {
             artnet_destroy(artnet_node_obj);
             artnet_node_obj = nullptr;
         }
-        _artnet_mapping_count = 0;
         _artnet_initialized = false;
     }
 
+    // ArtNet reader thread: waits on the node's socket and lets libartnet
+    // handle what arrives (answering ArtPoll, recording ArtPollReplies), then
+    // polls the network on a fixed interval and drops nodes that stopped
+    // replying. The node outlives the thread: deinit_ArtNet() joins it first.
+    void artnet_reader_loop(artnet_node node) {
+        artnet_socket_t sd = artnet_get_sd(node);
+        auto next_poll = std::chrono::steady_clock::now() + std::chrono::milliseconds(ARTNET_POLL_INTERVAL_MS);
+
+        while (!_artnet_reader_stop.load()) {
+            fd_set rset;
+            FD_ZERO(&rset);
+            FD_SET(sd, &rset);
+            timeval tv{ 0, ARTNET_READER_WAKE_MS * 1000 };
+            int ready = select(static_cast<int>(sd) + 1, &rset, nullptr, nullptr, &tv);
+
+            std::lock_guard<std::mutex> lock(artnet_mutex);
+            if (ready > 0) artnet_read(node, 0);
+
+            auto now = std::chrono::steady_clock::now();
+            if (now >= next_poll) {
+                artnet_send_poll(node, nullptr, ARTNET_TTM_AUTO);
+                artnet_nl_expire(node, ARTNET_NODE_TIMEOUT_S);
+                next_poll = now + std::chrono::milliseconds(ARTNET_POLL_INTERVAL_MS);
+            }
+        }
+    }
+
     // Deinit all protocols (called under state_mutex)
     void deinit_all() {
         deinit_Serial();
@@ -952,50 +3031,135 @@ private:
         return true;
     }
 
-    void send_Serial(const unsigned char* snapshot, Protocol proto)
-    {
-        std::lock_guard<std::mutex> lock(serial_mutex);
+    // Returns true if the frame was handed to the port's writer; the writer
+    // thread does the I/O (and reconnects) without blocking the caller
+    bool send_Serial(SerialOutput& out, int output, const unsigned char* snapshot, int slots) {
+        if (!out.writer) return false;
+        out.writer->submit(snapshot, slots, output);
+        return true;
+    }
+};
 
-        if (!serial_obj.isOpen()) {
-            if (!can_attempt_reconnect()) return;
-            try {
-                openPort();
-            }
-            catch (const std::exception& e) {
-                std::cerr << "DMX Warning: Failed to open serial port: " << e.what() << std::endl;
-                return;
-            }
+// Audio-rate signals to DMX levels. Each input is reduced over one DMX frame
+// period (1 / refreshRate() of the bound DMX) and written to its mapped channel.
+// Ticked by the VM, the same thread that runs shreds, so it writes the working
+// frame exactly like channel() does.
+class DMXOut {
+public:
+    static constexpr int INPUTS = 8;
+    enum class Mode { Peak, Mean, Last };
+
+    explicit DMXOut(double srate) : _srate(srate) {
+        for (int i = 0; i < INPUTS; i++) reset_input(i);
+        rewindow();
+    }
+
+    void bind(DMX* dmx) {
+        _dmx = dmx;
+        rewindow();
+    }
+
+    bool map(int input, int uni, int ch) {
+        if (input < 0 || input >= INPUTS) {
+            std::cerr << "DMX Warning: DMXOut.map() input " << input << " out of range (0-" << INPUTS - 1 << "), ignored." << std::endl;
+            return false;
+        }
+        if (uni < DMX::MIN_UNIVERSE || uni > DMX::MAX_UNIVERSE) {
+            std::cerr << "DMX Warning: DMXOut.map() universe " << uni << " out of range (1-63999), ignored." << std::endl;
+            return false;
+        }
+        if (ch < 1 || ch > 512) {
+            std::cerr << "DMX Warning: DMXOut.map() channel " << ch << " out of range (1-512), ignored." << std::endl;
+            return false;
         }
+        _targets[input] = { uni, ch };
+        reset_input(input);
+        return true;
+    }
 
-        try {
-            if (proto == Protocol::Serial_Raw) {
-                // Break condition for "raw" FTDI/RS485 interfaces (OpenDMX style)
-                serial_obj.setBreak(true);
-                dmx_usleep(120);      // 88+ us break low
-                serial_obj.setBreak(false);
-                dmx_usleep(12);       // 8+ us Mark After Break high
-                serial_obj.write(snapshot, 513); // 1 start + 512 DMX channels
-                return;
-            }
+    void unmap(int input) {
+        if (input < 0 || input >= INPUTS) return;
+        _targets[input] = { 0, 0 };
+    }
+
+    Mode mode() const { return _mode; }
+    void mode(Mode m) {
+        _mode = m;
+        for (int i = 0; i < INPUTS; i++) reset_input(i);
+    }
 
-            if (proto == Protocol::Serial) {
-                // Buffered interfaces (e.g., Enttec DMX USB Pro, DMXking, DSD Tech)
-                unsigned char buf[5 + DMX_PAYLOAD_LEN];
-                buf[0] = ENTTEC_START_MSG;
-                buf[1] = ENTTEC_SEND_DMX;
-                buf[2] = DMX_PAYLOAD_LEN & 0xFF;          // Data length LSB
-                buf[3] = (DMX_PAYLOAD_LEN >> 8) & 0xFF;   // Data length MSB
-                memcpy(&buf[4], snapshot, DMX_PAYLOAD_LEN);
-                buf[4 + DMX_PAYLOAD_LEN] = ENTTEC_END_MSG;
-                serial_obj.write(buf, sizeof(buf));
-                return;
+    // in/out hold nframes interleaved frames of INPUTS samples; audio passes through
+    void tick(const float* in, float* out, unsigned nframes) {
+        if (in != out) memcpy(out, in, sizeof(float) * INPUTS * nframes);
+        if (!_dmx) return;
+
+        for (unsigned f = 0; f < nframes; f++) {
+            const float* frame = in + f * INPUTS;
+            for (int i = 0; i < INPUTS; i++) {
+                float x = frame[i];
+                float mag = std::fabs(x);
+                if (mag > _peak[i]) _peak[i] = mag;
+                _sum[i] += mag;
+                _last[i] = x;
             }
+            if (++_count >= _window) flush();
         }
-        catch (const std::exception& e) {
-            std::cerr << "DMX Error: Serial write error: " << e.what() << std::endl;
-            try { if (serial_obj.isOpen()) serial_obj.close(); }
-            catch (...) {}
+    }
+
+private:
+    struct Target {
+        int universe;
+        int channel;
+    };
+
+    DMX* _dmx{ nullptr };
+    double _srate;
+    Mode _mode{ Mode::Peak };
+    Target _targets[INPUTS]{};
+    float _peak[INPUTS];
+    double _sum[INPUTS];
+    float _last[INPUTS];
+    unsigned _count{ 0 };
+    unsigned _window{ 1 };
+
+    void reset_input(int i) {
+        _peak[i] = 0.0f;
+        _sum[i] = 0.0;
+        _last[i] = 0.0f;
+    }
+
+    // Samples per DMX frame, following the bound DMX's refresh rate
+    void rewindow() {
+        double hz = _dmx ? _dmx->refreshRate() : DMX::DEFAULT_REFRESH_HZ;
+        double w = _srate / hz;
+        _window = w < 1.0 ? 1u : static_cast<unsigned>(w);
+    }
+
+    static int to_level(double x) {
+        x = x < 0.0 ? 0.0 : (x > 1.0 ? 1.0 : x);
+        return static_cast<int>(x * 255.0 + 0.5);
+    }
+
+    void flush() {
+        bool wrote = false;
+        for (int i = 0; i < INPUTS; i++) {
+            if (_targets[i].channel == 0) continue;
+            double v = 0.0;
+            switch (_mode) {
+            case Mode::Peak: v = _peak[i]; break;
+            case Mode::Mean: v = _sum[i] / _count; break;
+            case Mode::Last: v = _last[i]; break;
+            }
+            _dmx->channel(_targets[i].universe, _targets[i].channel, to_level(v));
+            wrote = true;
         }
+        for (int i = 0; i < INPUTS; i++) reset_input(i);
+        _count = 0;
+
+        // In async mode send() only publishes, so the frame can go out without
+        // a shred loop; in synchronous mode the user's send() picks it up
+        if (wrote && _dmx->async()) _dmx->send();
+        rewindow();
     }
 };
 
@@ -1004,6 +3168,7 @@ private:
 CK_DLL_CTOR(dmx_ctor) {
     OBJ_MEMBER_INT(SELF, dmx_data_offset) = 0;
     DMX* dmx_obj = new DMX();
+    dmx_obj->attach_vm(VM, API);
     OBJ_MEMBER_INT(SELF, dmx_data_offset) = (t_CKINT)dmx_obj;
 }
 
@@ -1055,6 +3220,13 @@ CK_DLL_MFUN(dmx_channel_uni) {
     t_CKINT value = GET_NEXT_INT(ARGS);
     dmx_obj->channel(static_cast<int>(uni), static_cast<int>(ch), static_cast<int>(value));
 }
+// Read n levels from a ChucK int array starting at offset, clamped to 0-255
+static void read_levels(CK_DL_API API, Chuck_ArrayInt* arr, t_CKINT offset, unsigned char* out, int n) {
+    t_CKINT raw[512];
+    for (int i = 0; i < n; i++) raw[i] = API->object->array_int_get_idx(arr, offset + i);
+    clamp_copy_dmx(raw, out, n);
+}
+
 CK_DLL_MFUN(dmx_channels) {
     DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
     if (!dmx_obj) return;
@@ -1068,13 +3240,44 @@ CK_DLL_MFUN(dmx_channels) {
     if (count > 512) count = 512;
 
     unsigned char values[512];
-    for (t_CKINT i = 0; i < count; i++) {
-        values[i] = static_cast<unsigned char>(clamp_dmx(static_cast<int>(API->object->array_int_get_idx(arr, i))));
-    }
-
+    read_levels(API, arr, 0, values, static_cast<int>(count));
     dmx_obj->channels(static_cast<int>(startCh), values, static_cast<int>(count));
 }
 
+CK_DLL_MFUN(dmx_frame) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) return;
+
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    Chuck_ArrayInt* arr = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    if (!arr) return;
+
+    t_CKINT count = API->object->array_int_size(arr);
+    if (count <= 0) return;
+    if (count > 512) count = 512;
+
+    unsigned char values[512];
+    read_levels(API, arr, 0, values, static_cast<int>(count));
+    dmx_obj->frame(static_cast<int>(uni), values, static_cast<int>(count));
+}
+
+CK_DLL_MFUN(dmx_get_frame) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    Chuck_ArrayInt* arr = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    RETURN->v_int = 0;
+    if (!dmx_obj || !arr) return;
+
+    const unsigned char* levels = dmx_obj->get_frame(static_cast<int>(uni));
+    if (!levels) return;
+
+    // Fill the caller's array in place; never resized
+    t_CKINT count = API->object->array_int_size(arr);
+    if (count > 512) count = 512;
+    for (t_CKINT i = 0; i < count; i++) API->object->array_int_set_idx(arr, i, levels[i]);
+    RETURN->v_int = count;
+}
+
 CK_DLL_MFUN(dmx_init) {
     DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
     if (!dmx_obj) { RETURN->v_int = 0; return; }
@@ -1104,32 +3307,260 @@ CK_DLL_MFUN(dmx_connected) {
 
 CK_DLL_MFUN(dmx_debug) {
     DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
-    if (!dmx_obj) { RETURN->v_int = 0; return; }
-    t_CKINT enable = GET_NEXT_INT(ARGS);
-    dmx_obj->debug(static_cast<int>(enable));
-    RETURN->v_int = enable;
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    t_CKINT enable = GET_NEXT_INT(ARGS);
+    dmx_obj->debug(static_cast<int>(enable));
+    RETURN->v_int = enable;
+}
+
+// Async output
+
+CK_DLL_MFUN(dmx_get_async) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->async() ? 1 : 0;
+}
+CK_DLL_MFUN(dmx_async) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT enable = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = enable; return; }
+    dmx_obj->async(enable != 0);
+    RETURN->v_int = enable;
+}
+
+CK_DLL_MFUN(dmx_get_refresh_rate) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_float = 0; return; }
+    RETURN->v_float = dmx_obj->refreshRate();
+}
+CK_DLL_MFUN(dmx_refresh_rate) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKFLOAT hz = GET_NEXT_FLOAT(ARGS);
+    if (!dmx_obj) { RETURN->v_float = hz; return; }
+    dmx_obj->refreshRate(static_cast<double>(hz));
+    RETURN->v_float = hz;
+}
+
+CK_DLL_MFUN(dmx_allocations) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = static_cast<t_CKINT>(dmx_obj->allocations());
+}
+
+CK_DLL_MFUN(dmx_get_min_slots) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 512; return; }
+    RETURN->v_int = dmx_obj->minSlots();
+}
+CK_DLL_MFUN(dmx_min_slots) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT n = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = n; return; }
+    dmx_obj->minSlots(static_cast<int>(n));
+    RETURN->v_int = dmx_obj->minSlots();
+}
+
+CK_DLL_MFUN(dmx_get_break_mode) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = dmx_BREAK_IOCTL; return; }
+    RETURN->v_int = dmx_obj->breakMode();
+}
+CK_DLL_MFUN(dmx_break_mode) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT mode = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = mode; return; }
+    dmx_obj->breakMode(static_cast<int>(mode));
+    RETURN->v_int = dmx_obj->breakMode();
+}
+
+CK_DLL_MFUN(dmx_get_pacing) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_float = 0; return; }
+    RETURN->v_float = dmx_obj->pacing();
+}
+CK_DLL_MFUN(dmx_get_pacing_gap) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->pacingGap();
+}
+CK_DLL_MFUN(dmx_pacing) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKFLOAT hz = GET_NEXT_FLOAT(ARGS);
+    t_CKINT gap_us = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->pacing(static_cast<double>(hz), static_cast<int>(gap_us)) ? 1 : 0;
+}
+CK_DLL_MFUN(dmx_paced_rate) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_float = 0; return; }
+    RETURN->v_float = dmx_obj->pacedRate();
+}
+CK_DLL_MFUN(dmx_pacing_jitter) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_float = 0; return; }
+    RETURN->v_float = dmx_obj->pacingJitter();
+}
+
+// ChucK-time scheduling
+
+CK_DLL_MFUN(dmx_send_at) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKTIME when = GET_NEXT_TIME(ARGS);
+    if (!dmx_obj) return;
+    dmx_obj->sendAt(when);
+}
+
+CK_DLL_MFUN(dmx_scheduled) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->scheduledCount();
+}
+
+CK_DLL_MFUN(dmx_clear_scheduled) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) return;
+    dmx_obj->clearScheduled();
+}
+
+CK_DLL_MFUN(dmx_get_clock) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = dmx_CLOCK_SYSTEM; return; }
+    RETURN->v_int = dmx_obj->clock() == DMX::Clock::ChucK ? dmx_CLOCK_CHUCK : dmx_CLOCK_SYSTEM;
+}
+CK_DLL_MFUN(dmx_clock) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT c = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = c; return; }
+
+    if (c == dmx_CLOCK_CHUCK) dmx_obj->clock(DMX::Clock::ChucK);
+    else if (c == dmx_CLOCK_SYSTEM) dmx_obj->clock(DMX::Clock::System);
+    else std::cerr << "DMX Warning: clock() unknown clock " << c << ", ignored." << std::endl;
+    RETURN->v_int = dmx_obj->clock() == DMX::Clock::ChucK ? dmx_CLOCK_CHUCK : dmx_CLOCK_SYSTEM;
+}
+
+// Serial
+
+CK_DLL_MFUN(dmx_get_port) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_string = API->object->create_string(VM, "", 0); return; }
+    const std::string& p = dmx_obj->port();
+    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+}
+CK_DLL_MFUN(dmx_port) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    std::string n = GET_NEXT_STRING_SAFE(ARGS);
+    if (!dmx_obj) { RETURN->v_string = API->object->create_string(VM, n.c_str(), (t_CKUINT)n.length()); return; }
+
+    dmx_obj->port(n);
+    RETURN->v_string = API->object->create_string(VM, n.c_str(), (t_CKUINT)n.length());
+}
+
+CK_DLL_MFUN(dmx_get_universe_port) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_string = API->object->create_string(VM, "", 0); return; }
+    std::string p = dmx_obj->port(static_cast<int>(uni));
+    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+}
+CK_DLL_MFUN(dmx_universe_port) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    std::string n = GET_NEXT_STRING_SAFE(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->port(static_cast<int>(uni), n) ? 1 : 0;
+}
+
+CK_DLL_MFUN(dmx_universe_port_output) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    std::string n = GET_NEXT_STRING_SAFE(ARGS);
+    t_CKINT output = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->port(static_cast<int>(uni), n, static_cast<int>(output)) ? 1 : 0;
+}
+
+CK_DLL_MFUN(dmx_widget_params) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT break_us = GET_NEXT_INT(ARGS);
+    t_CKINT mab_us = GET_NEXT_INT(ARGS);
+    t_CKINT rate = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->widgetParams(static_cast<int>(break_us), static_cast<int>(mab_us),
+                                          static_cast<int>(rate)) ? 1 : 0;
+}
+
+CK_DLL_MFUN(dmx_get_port2_label) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->port2Label();
+}
+CK_DLL_MFUN(dmx_port2_label) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT label = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = label; return; }
+    dmx_obj->port2Label(static_cast<int>(label));
+    RETURN->v_int = dmx_obj->port2Label();
+}
+
+CK_DLL_MFUN(dmx_ports_event) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    RETURN->v_object = dmx_obj ? dmx_obj->ports_event() : nullptr;
+}
+
+CK_DLL_SFUN(dmx_list_ports) {
+    std::string p = DMX::ports();
+    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+}
+
+// Serial input
+
+CK_DLL_MFUN(dmx_get_input) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    std::string p = dmx_obj ? dmx_obj->input() : std::string();
+    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+}
+CK_DLL_MFUN(dmx_input) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    std::string n = GET_NEXT_STRING_SAFE(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->input(n, DMX::Protocol::Serial) ? 1 : 0;
+}
+CK_DLL_MFUN(dmx_input_framing) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    std::string n = GET_NEXT_STRING_SAFE(ARGS);
+    t_CKINT framing = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    if (framing != dmx_SERIAL && framing != dmx_SERIAL_RAW) {
+        std::cerr << "DMX Warning: input() framing must be DMX.SERIAL or DMX.SERIAL_RAW." << std::endl;
+        RETURN->v_int = 0;
+        return;
+    }
+    RETURN->v_int = dmx_obj->input(n, static_cast<DMX::Protocol>(framing)) ? 1 : 0;
+}
+CK_DLL_MFUN(dmx_input_channel) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT ch = GET_NEXT_INT(ARGS);
+    RETURN->v_int = dmx_obj ? dmx_obj->inputChannel(static_cast<int>(ch)) : 0;
 }
-
-// Serial
-
-CK_DLL_MFUN(dmx_get_port) {
+CK_DLL_MFUN(dmx_input_frame) {
     DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
-    if (!dmx_obj) { RETURN->v_string = API->object->create_string(VM, "", 0); return; }
-    const std::string& p = dmx_obj->port();
-    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+    Chuck_ArrayInt* arr = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    RETURN->v_int = 0;
+    if (!dmx_obj || !arr) return;
+    const SerialReader::InputFrame* f = dmx_obj->inputFrame();
+    if (!f) return;
+    t_CKINT n = std::min<t_CKINT>(API->object->array_int_size(arr), f->slots);
+    for (t_CKINT i = 0; i < n; i++)
+        API->object->array_int_set_idx(arr, i, f->data[1 + i]);
+    RETURN->v_int = f->slots;
 }
-CK_DLL_MFUN(dmx_port) {
+CK_DLL_MFUN(dmx_input_count) {
     DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
-    std::string n = GET_NEXT_STRING_SAFE(ARGS);
-    if (!dmx_obj) { RETURN->v_string = API->object->create_string(VM, n.c_str(), (t_CKUINT)n.length()); return; }
-
-    dmx_obj->port(n);
-    RETURN->v_string = API->object->create_string(VM, n.c_str(), (t_CKUINT)n.length());
+    RETURN->v_int = dmx_obj ? static_cast<t_CKINT>(dmx_obj->inputCount()) : 0;
 }
-
-CK_DLL_SFUN(dmx_list_ports) {
-    std::string p = DMX::ports();
-    RETURN->v_string = API->object->create_string(VM, p.c_str(), (t_CKUINT)p.length());
+CK_DLL_MFUN(dmx_input_event) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    RETURN->v_object = dmx_obj ? dmx_obj->input_event() : nullptr;
 }
 
 // sACN and ArtNet
@@ -1191,6 +3622,41 @@ CK_DLL_MFUN(dmx_priority) {
     RETURN->v_int = p;
 }
 
+// ArtSync
+
+CK_DLL_MFUN(dmx_get_artnet_sync) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->artnetSync() ? 1 : 0;
+}
+CK_DLL_MFUN(dmx_artnet_sync) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT enable = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = enable; return; }
+
+    dmx_obj->artnetSync(enable != 0);
+    RETURN->v_int = enable;
+}
+
+CK_DLL_MFUN(dmx_get_artnet_unicast) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->artnetUnicast();
+}
+CK_DLL_MFUN(dmx_artnet_unicast) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    t_CKINT limit = GET_NEXT_INT(ARGS);
+    if (!dmx_obj) { RETURN->v_int = limit; return; }
+
+    dmx_obj->artnetUnicast(static_cast<int>(limit));
+    RETURN->v_int = limit;
+}
+CK_DLL_MFUN(dmx_artnet_nodes) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) { RETURN->v_int = 0; return; }
+    RETURN->v_int = dmx_obj->artnetNodes();
+}
+
 // Source name
 
 CK_DLL_MFUN(dmx_get_name) {
@@ -1231,6 +3697,127 @@ CK_DLL_MFUN(dmx_fade_uni) {
     dmx_obj->fade(static_cast<int>(uni), static_cast<int>(ch), static_cast<int>(target), static_cast<int>(durationMs));
 }
 
+// Crossfade
+
+CK_DLL_MFUN(dmx_crossfade) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) return;
+
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    Chuck_ArrayInt* arr = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    t_CKINT durationMs = GET_NEXT_INT(ARGS);
+    if (!arr) return;
+
+    t_CKINT count = API->object->array_int_size(arr);
+    if (count > 512) count = 512;
+
+    unsigned char values[512];
+    read_levels(API, arr, 0, values, static_cast<int>(count));
+    dmx_obj->crossfade(static_cast<int>(uni), values, static_cast<int>(count), static_cast<int>(durationMs));
+}
+
+CK_DLL_MFUN(dmx_crossfade_multi) {
+    DMX* dmx_obj = (DMX*)OBJ_MEMBER_INT(SELF, dmx_data_offset);
+    if (!dmx_obj) return;
+
+    Chuck_ArrayInt* unis = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    Chuck_ArrayInt* arr = (Chuck_ArrayInt*)GET_NEXT_OBJECT(ARGS);
+    t_CKINT durationMs = GET_NEXT_INT(ARGS);
+    if (!unis || !arr) return;
+
+    // targets holds 512 levels per listed universe, back to back
+    t_CKINT n = API->object->array_int_size(unis);
+    t_CKINT size = API->object->array_int_size(arr);
+    if (size < n * 512) {
+        std::cerr << "DMX Warning: crossfade() expected " << n * 512 << " target levels, got " << size
+                  << "; missing channels keep their current level." << std::endl;
+    }
+
+    unsigned char values[512];
+    for (t_CKINT u = 0; u < n; u++) {
+        t_CKINT base = u * 512;
+        t_CKINT count = size - base;
+        if (count > 512) count = 512;
+        if (count < 0) count = 0;
+        read_levels(API, arr, base, values, static_cast<int>(count));
+        dmx_obj->crossfade(static_cast<int>(API->object->array_int_get_idx(unis, u)), values,
+                           static_cast<int>(count), static_cast<int>(durationMs));
+    }
+}
+
+// DMXOut
+
+CK_DLL_CTOR(dmxout_ctor) {
+    OBJ_MEMBER_INT(SELF, dmxout_data_offset) = 0;
+    OBJ_MEMBER_INT(SELF, dmxout_ref_offset) = 0;
+    DMXOut* out = new DMXOut(static_cast<double>(API->vm->srate(VM)));
+    OBJ_MEMBER_INT(SELF, dmxout_data_offset) = (t_CKINT)out;
+}
+
+CK_DLL_DTOR(dmxout_dtor) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    CK_SAFE_DELETE(out);
+    OBJ_MEMBER_INT(SELF, dmxout_data_offset) = 0;
+    Chuck_Object* ref = (Chuck_Object*)OBJ_MEMBER_INT(SELF, dmxout_ref_offset);
+    if (ref) API->object->release(ref);
+    OBJ_MEMBER_INT(SELF, dmxout_ref_offset) = 0;
+}
+
+CK_DLL_TICKF(dmxout_tickf) {
+    DMXOut* dmx_out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    if (!dmx_out) return FALSE;
+    dmx_out->tick(in, out, static_cast<unsigned>(nframes));
+    return TRUE;
+}
+
+CK_DLL_MFUN(dmxout_dmx) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    Chuck_Object* obj = GET_NEXT_OBJECT(ARGS);
+    RETURN->v_object = obj;
+    if (!out) return;
+
+    // Hold the DMX object for as long as it is bound
+    Chuck_Object* old = (Chuck_Object*)OBJ_MEMBER_INT(SELF, dmxout_ref_offset);
+    if (obj) API->object->add_ref(obj);
+    if (old) API->object->release(old);
+    OBJ_MEMBER_INT(SELF, dmxout_ref_offset) = (t_CKINT)obj;
+    out->bind(obj ? (DMX*)OBJ_MEMBER_INT(obj, dmx_data_offset) : nullptr);
+}
+
+CK_DLL_MFUN(dmxout_map) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    t_CKINT input = GET_NEXT_INT(ARGS);
+    t_CKINT uni = GET_NEXT_INT(ARGS);
+    t_CKINT ch = GET_NEXT_INT(ARGS);
+    if (!out) { RETURN->v_int = 0; return; }
+    RETURN->v_int = out->map(static_cast<int>(input), static_cast<int>(uni), static_cast<int>(ch)) ? 1 : 0;
+}
+
+CK_DLL_MFUN(dmxout_unmap) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    t_CKINT input = GET_NEXT_INT(ARGS);
+    if (!out) return;
+    out->unmap(static_cast<int>(input));
+}
+
+CK_DLL_MFUN(dmxout_get_mode) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    if (!out) { RETURN->v_int = dmxout_PEAK; return; }
+    RETURN->v_int = static_cast<t_CKINT>(out->mode());
+}
+
+CK_DLL_MFUN(dmxout_mode) {
+    DMXOut* out = (DMXOut*)OBJ_MEMBER_INT(SELF, dmxout_data_offset);
+    t_CKINT m = GET_NEXT_INT(ARGS);
+    if (!out) { RETURN->v_int = m; return; }
+
+    if (m == dmxout_MEAN) out->mode(DMXOut::Mode::Mean);
+    else if (m == dmxout_LAST) out->mode(DMXOut::Mode::Last);
+    else if (m == dmxout_PEAK) out->mode(DMXOut::Mode::Peak);
+    else std::cerr << "DMX Warning: DMXOut.mode() unknown mode " << m << ", ignored." << std::endl;
+    RETURN->v_int = static_cast<t_CKINT>(out->mode());
+}
+
 CK_DLL_INFO(DMX)
 {
     QUERY->setinfo(QUERY, CHUGIN_INFO_CHUGIN_VERSION, "v0.2.0");
@@ -1274,6 +3861,18 @@ CK_DLL_QUERY(DMX) {
     QUERY->add_svar(QUERY, "int", "ARTNET", TRUE, &dmx_ARTNET);
     QUERY->doc_var(QUERY, "Protocol constant for Art-Net (DMX over Ethernet).");
 
+    QUERY->add_svar(QUERY, "int", "CLOCK_SYSTEM", TRUE, &dmx_CLOCK_SYSTEM);
+    QUERY->doc_var(QUERY, "Fade clock constant: time fades with the system's monotonic clock (default).");
+
+    QUERY->add_svar(QUERY, "int", "CLOCK_CHUCK", TRUE, &dmx_CLOCK_CHUCK);
+    QUERY->doc_var(QUERY, "Fade clock constant: time fades with ChucK logical time (now).");
+
+    QUERY->add_svar(QUERY, "int", "BREAK_IOCTL", TRUE, &dmx_BREAK_IOCTL);
+    QUERY->doc_var(QUERY, "Raw serial break constant: hold the line in break for 120 us via ioctl (default).");
+
+    QUERY->add_svar(QUERY, "int", "BREAK_BAUD", TRUE, &dmx_BREAK_BAUD);
+    QUERY->doc_var(QUERY, "Raw serial break constant: send a 0x00 byte at 76800 baud as the break (Linux).");
+
     // --- Protocol ---
 
     QUERY->add_mfun(QUERY, dmx_get_protocol, "int", "protocol");
@@ -1323,7 +3922,24 @@ CK_DLL_QUERY(DMX) {
     QUERY->doc_func(QUERY,
         "Set multiple consecutive DMX channels starting at startChannel on the active universe. "
         "Values are clamped to 0-255. Cancels any active fades on affected channels. "
-        "All channels are updated atomically under a single lock."
+        "All channels land in the same frame on the next send()."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_frame, "void", "frame");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "int[]", "values");
+    QUERY->doc_func(QUERY,
+        "Set a whole universe in one call: values[0] is channel 1, up to 512 values. "
+        "Values are clamped to 0-255; channels past the end of the array are left unchanged. "
+        "Cancels fades and crossfades on affected channels. The universe must already exist."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_frame, "int", "getFrame");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "int[]", "values");
+    QUERY->doc_func(QUERY,
+        "Read a universe's current levels into values (values[0] is channel 1) without resizing it. "
+        "Fills up to 512 entries and returns how many were written, or 0 if the universe does not exist."
     );
 
     // --- Init / Send / Lifecycle ---
@@ -1340,9 +3956,12 @@ CK_DLL_QUERY(DMX) {
     QUERY->add_mfun(QUERY, dmx_send, "void", "send");
     QUERY->doc_func(QUERY,
         "Advance any active fades, then transmit the current DMX buffer for all configured "
-        "universes over the active protocol. For Serial, only the active universe is sent. "
+        "universes over the active protocol. For Serial, every universe mapped with "
+        "port(universe, port) goes out on its own port in parallel; without mappings, only the "
+        "active universe is sent on port(string). "
         "This is the only method that sends data — call it explicitly after buffering changes. "
-        "For fades, call send() periodically (e.g., every 23ms) to drive the interpolation."
+        "For fades, call send() periodically (e.g., every 23ms) to drive the interpolation. "
+        "In async mode, send() only publishes the frame; the output thread transmits it."
     );
 
     QUERY->add_mfun(QUERY, dmx_blackout, "void", "blackout");
@@ -1362,6 +3981,73 @@ CK_DLL_QUERY(DMX) {
         "Enable (1) or disable (0) debug output to stderr showing channel values on each send()."
     );
 
+    QUERY->add_mfun(QUERY, dmx_allocations, "int", "allocations");
+    QUERY->doc_func(QUERY,
+        "Number of heap allocations this DMX object has made for universe, fade and sendAt() "
+        "buffers. Buffers are sized when universes are added, so with a stable setup the count "
+        "stays flat across send() calls."
+    );
+
+    // --- Async output ---
+
+    QUERY->add_mfun(QUERY, dmx_get_async, "int", "async");
+    QUERY->doc_func(QUERY,
+        "Returns 1 if async output mode is enabled, 0 otherwise."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_async, "int", "async");
+    QUERY->add_arg(QUERY, "int", "enable");
+    QUERY->doc_func(QUERY,
+        "Enable (1) or disable (0) async output mode. When enabled, a background thread owns "
+        "all serial/sACN/ArtNet I/O and retransmits the latest frame at refreshRate(); send() "
+        "only advances fades and publishes the frame, so a slow or stalled interface never "
+        "blocks the ChucK VM. Default: 0 (send() transmits immediately)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_refresh_rate, "float", "refreshRate");
+    QUERY->doc_func(QUERY,
+        "Get the async output refresh rate in Hz (default 44)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_refresh_rate, "float", "refreshRate");
+    QUERY->add_arg(QUERY, "float", "hz");
+    QUERY->doc_func(QUERY,
+        "Set the async output refresh rate in Hz (1-1000, default 44). "
+        "Only used when async output mode is enabled."
+    );
+
+    // --- ChucK time ---
+
+    QUERY->add_mfun(QUERY, dmx_get_clock, "int", "clock");
+    QUERY->doc_func(QUERY,
+        "Get the fade clock (DMX.CLOCK_SYSTEM or DMX.CLOCK_CHUCK)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_clock, "int", "clock");
+    QUERY->add_arg(QUERY, "int", "clock");
+    QUERY->doc_func(QUERY,
+        "Set the fade clock. DMX.CLOCK_CHUCK times fades with ChucK logical time, so they stay "
+        "locked to the music in --silent or overloaded runs; DMX.CLOCK_SYSTEM (default) uses "
+        "wall-clock time. Running fades continue smoothly across a switch."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_send_at, "void", "sendAt");
+    QUERY->add_arg(QUERY, "time", "when");
+    QUERY->doc_func(QUERY,
+        "Advance fades and queue the current frames of all universes for transmission at ChucK "
+        "time 'when'. Queued frames go out in timestamp order and stay on the wire until a newer "
+        "frame is sent. In async mode the output thread transmits them at the matching wall-clock "
+        "time; otherwise they go out on the first send() at or after 'when' (or immediately if "
+        "'when' is not in the future). Changes made before sendAt() belong to the queued frame: "
+        "a send() in the meantime doesn't put them on the wire early."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_scheduled, "int", "scheduled");
+    QUERY->doc_func(QUERY, "Number of frames queued by sendAt() that have not been transmitted yet.");
+
+    QUERY->add_mfun(QUERY, dmx_clear_scheduled, "void", "clearScheduled");
+    QUERY->doc_func(QUERY, "Drop all frames queued by sendAt(). Their changes are not lost: the next send() transmits the current DMX buffer.");
+
     // --- Fade ---
 
     QUERY->add_mfun(QUERY, dmx_fade, "void", "fade");
@@ -1387,8 +4073,90 @@ CK_DLL_QUERY(DMX) {
         "The universe must already exist (via addUniverse() or universe())."
     );
 
+    QUERY->add_mfun(QUERY, dmx_crossfade, "void", "crossfade");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "int[]", "target");
+    QUERY->add_arg(QUERY, "int", "durationMs");
+    QUERY->doc_func(QUERY,
+        "Crossfade a whole universe to a new look over durationMs milliseconds. target[0] is channel 1; "
+        "channels beyond the array keep their current level. Replaces any running fades on the universe "
+        "and advances each time send() is called, like fade(). Setting or fading a single channel "
+        "mid-crossfade takes that channel over. If durationMs <= 0, the look is set immediately."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_crossfade_multi, "void", "crossfade");
+    QUERY->add_arg(QUERY, "int[]", "universes");
+    QUERY->add_arg(QUERY, "int[]", "targets");
+    QUERY->add_arg(QUERY, "int", "durationMs");
+    QUERY->doc_func(QUERY,
+        "Crossfade several universes at once. targets holds 512 levels per entry in universes, "
+        "back to back (universes[i] uses targets[i*512] .. targets[i*512+511]). "
+        "All listed universes start together and must already exist."
+    );
+
     // --- Serial ---
 
+    QUERY->add_mfun(QUERY, dmx_get_min_slots, "int", "minSlots");
+    QUERY->doc_func(QUERY,
+        "Get the minimum number of channel slots per serial frame (default 512)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_min_slots, "int", "minSlots");
+    QUERY->add_arg(QUERY, "int", "slots");
+    QUERY->doc_func(QUERY,
+        "Set the minimum number of channel slots per serial frame (1-512, default 512). Serial "
+        "frames carry max(minSlots, highest channel used on the universe) slots, so lowering it "
+        "lets small rigs refresh faster: a 48-channel frame takes about 2.3 ms on the wire instead "
+        "of 22.7 ms. Some fixtures expect full frames; keep 512 if they misbehave."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_break_mode, "int", "breakMode");
+    QUERY->doc_func(QUERY,
+        "Get the raw serial break strategy (DMX.BREAK_IOCTL or DMX.BREAK_BAUD)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_break_mode, "int", "breakMode");
+    QUERY->add_arg(QUERY, "int", "mode");
+    QUERY->doc_func(QUERY,
+        "Set how SERIAL_RAW generates the break before each frame. DMX.BREAK_IOCTL (default) "
+        "toggles the break condition, timed to within a few microseconds. DMX.BREAK_BAUD "
+        "(Linux only) sends a 0x00 byte at 76800 baud so the UART itself times a 117 us break "
+        "and 26 us MAB; ports that cannot switch baud fall back to BREAK_IOCTL."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_pacing, "float", "pacing");
+    QUERY->doc_func(QUERY,
+        "Get the serial frame pacing rate in Hz (0 = unpaced, the default)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_pacing_gap, "int", "pacingGap");
+    QUERY->doc_func(QUERY,
+        "Get the minimum gap between serial frame starts in microseconds (0 = none)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_pacing, "int", "pacing");
+    QUERY->add_arg(QUERY, "float", "hz");
+    QUERY->add_arg(QUERY, "int", "minGapUs");
+    QUERY->doc_func(QUERY,
+        "Pace serial output. With hz > 0 (1-1000) each port starts a frame on a fixed-rate "
+        "absolute-deadline timer, carrying the newest frame sent (repeated if nothing changed), so "
+        "spacing no longer depends on when shreds call send(); 0 writes frames as they come. "
+        "minGapUs (0-1000000) keeps frame starts at least that far apart either way. Calls in "
+        "between coalesce into the latest frame. Returns 1 on success."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_paced_rate, "float", "pacedRate");
+    QUERY->doc_func(QUERY,
+        "Achieved serial frame rate over the last second, in frames per second (the slowest port "
+        "if several are mapped; 0 while idle)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_pacing_jitter, "float", "pacingJitter");
+    QUERY->doc_func(QUERY,
+        "Mean lateness of paced serial frame starts over the last second, in microseconds "
+        "(the worst port if several are mapped)."
+    );
+
     QUERY->add_mfun(QUERY, dmx_get_port, "string", "port");
     QUERY->doc_func(QUERY,
         "Get the currently configured serial port string (e.g., '/dev/ttyUSB0' or 'COM3')."
@@ -1401,10 +4169,116 @@ CK_DLL_QUERY(DMX) {
         "Configure this before init()."
     );
 
+    QUERY->add_mfun(QUERY, dmx_get_universe_port, "string", "port");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->doc_func(QUERY,
+        "Get the serial port a universe is mapped to, or an empty string if it is not mapped."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_universe_port, "int", "port");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "string", "port");
+    QUERY->doc_func(QUERY,
+        "Map a universe to its own serial interface (an empty string unmaps it); the universe is "
+        "created if needed. Once any universe is mapped, send() pushes every mapped universe to "
+        "its port in parallel, each port on its own writer thread, and port(string) and the active "
+        "universe are no longer used for serial. A port carries one universe; mapping it again "
+        "moves it. Works before or after init(). Returns 1 on success."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_universe_port_output, "int", "port");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "string", "port");
+    QUERY->add_arg(QUERY, "int", "output");
+    QUERY->doc_func(QUERY,
+        "Map a universe to output 1 or 2 of a serial interface. Output 2 is the second universe "
+        "of an Enttec DMX USB Pro Mk2-style widget (SERIAL protocol only), sent with port2Label(); "
+        "both universes share the one USB link. Returns 1 on success."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_port2_label, "int", "port2Label");
+    QUERY->doc_func(QUERY,
+        "Get the Enttec message label used for output 2 frames (0 = output 2 unused)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_port2_label, "int", "port2Label");
+    QUERY->add_arg(QUERY, "int", "label");
+    QUERY->doc_func(QUERY,
+        "Set the Enttec message label for output 2 frames (0-255, default 0 = unused). Pro "
+        "Mk2-style firmware assigns this label once its API key is set; see the widget's API "
+        "documentation."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_widget_params, "int", "widgetParams");
+    QUERY->add_arg(QUERY, "int", "breakUs");
+    QUERY->add_arg(QUERY, "int", "mabUs");
+    QUERY->add_arg(QUERY, "int", "rate");
+    QUERY->doc_func(QUERY,
+        "Set the output timing of Enttec-style widgets (SERIAL protocol): break 96-1355 us, "
+        "mark after break 11-1355 us (both in 10.67 us steps) and refresh rate 1-40 frames per "
+        "second, or 0 for as fast as possible. Sent as a 'set parameters' message to every port "
+        "now and again after each reconnect, so the widget times frames itself. Returns 1 on success."
+    );
+
     QUERY->add_sfun(QUERY, dmx_list_ports, "string", "ports");
     QUERY->doc_func(QUERY,
         "Returns a comma-separated string of available serial port names (e.g., 'COM3,COM5'). "
-        "Use this to discover connected DMX interfaces."
+        "Use this to discover connected DMX interfaces. The list is cached and refreshed when "
+        "devices are plugged or unplugged, so calling this in a loop is cheap."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_ports_event, "Event", "portsEvent");
+    QUERY->doc_func(QUERY,
+        "Get an Event that is broadcast whenever a serial device appears or disappears "
+        "(dmx.portsEvent() => now; then check DMX.ports()). Serial ports that are down "
+        "reconnect at once when a device appears instead of waiting out the 5 s retry delay."
+    );
+
+    // --- Serial input ---
+
+    QUERY->add_mfun(QUERY, dmx_get_input, "string", "input");
+    QUERY->doc_func(QUERY,
+        "Get the serial port DMX input is read from, or an empty string if input is off."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input, "int", "input");
+    QUERY->add_arg(QUERY, "string", "port");
+    QUERY->doc_func(QUERY,
+        "Receive DMX from an Enttec-style widget on a serial port (\"received DMX\" messages); "
+        "an empty string stops input. A background thread reads the port, so shreds never poll "
+        "it. Independent of the output protocol. Returns 1 if the port opened."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input_framing, "int", "input");
+    QUERY->add_arg(QUERY, "string", "port");
+    QUERY->add_arg(QUERY, "int", "framing");
+    QUERY->doc_func(QUERY,
+        "Receive DMX on a serial port with DMX.SERIAL (Enttec widget) or DMX.SERIAL_RAW framing. "
+        "SERIAL_RAW reads a plain RS-485 line and splits frames at breaks (not on Windows)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input_channel, "int", "inputChannel");
+    QUERY->add_arg(QUERY, "int", "ch");
+    QUERY->doc_func(QUERY,
+        "Get a channel (1-512) of the latest received frame; 0 before any input arrives."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input_frame, "int", "inputFrame");
+    QUERY->add_arg(QUERY, "int[]", "levels");
+    QUERY->doc_func(QUERY,
+        "Copy the latest received frame into levels (up to its size). Returns the number of "
+        "channels in the received frame, or 0 if none has arrived."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input_count, "int", "inputCount");
+    QUERY->doc_func(QUERY,
+        "Get the number of valid frames received since input() started."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_input_event, "Event", "inputEvent");
+    QUERY->doc_func(QUERY,
+        "Get an Event that is broadcast whenever a received frame changes any level: "
+        "dmx.inputEvent() => now; then read inputChannel() or inputFrame()."
     );
 
     // --- sACN and ArtNet ---
@@ -1418,7 +4292,7 @@ CK_DLL_QUERY(DMX) {
     QUERY->add_arg(QUERY, "int", "universe");
     QUERY->doc_func(QUERY,
         "Set the active DMX universe (1-63999). Channel and fade operations target this universe. "
-        "If the universe does not exist yet, it is automatically created (up to 64 universes). "
+        "If the universe does not exist yet, it is automatically created. "
         "Use addUniverse() to add universes without switching."
     );
 
@@ -1426,9 +4300,9 @@ CK_DLL_QUERY(DMX) {
     QUERY->add_arg(QUERY, "int", "universe");
     QUERY->doc_func(QUERY,
         "Add a universe (1-63999) to this DMX instance without switching the active universe. "
-        "Returns 1 on success, 0 on failure. Maximum 64 universes per instance. "
-        "If sACN is already initialized, the universe is added live. "
-        "ArtNet requires re-initialization via init() to add universes."
+        "Returns 1 on success, 0 on failure. There is no per-instance universe limit. "
+        "If sACN or ArtNet is already initialized, the universe is added live. ArtNet sends "
+        "universe N to Port-Address N-1 (Net:SubNet:Universe), so universes 1-32768 are reachable."
     );
 
     QUERY->add_mfun(QUERY, dmx_remove_universe, "int", "removeUniverse");
@@ -1466,6 +4340,40 @@ CK_DLL_QUERY(DMX) {
         "updates live on all configured universes."
     );
 
+    QUERY->add_mfun(QUERY, dmx_get_artnet_sync, "int", "artnetSync");
+    QUERY->doc_func(QUERY,
+        "Returns 1 if ArtNet sends are followed by an ArtSync, 0 otherwise (default 0)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_artnet_sync, "int", "artnetSync");
+    QUERY->add_arg(QUERY, "int", "enable");
+    QUERY->doc_func(QUERY,
+        "Enable (1) or disable (0) ArtSync. When enabled, each send() broadcasts one ArtSync "
+        "after the ArtDmx packets of all universes, so receivers that support synchronous "
+        "mode output every universe of the frame at the same moment instead of one packet "
+        "at a time. Receivers fall back to immediate output if no ArtSync arrives for 4 s."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_get_artnet_unicast, "int", "artnetUnicast");
+    QUERY->doc_func(QUERY,
+        "Get the ArtNet unicast limit (0-30, default 10; 0 = always broadcast)."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_artnet_unicast, "int", "artnetUnicast");
+    QUERY->add_arg(QUERY, "int", "limit");
+    QUERY->doc_func(QUERY,
+        "Set the ArtNet unicast limit (0-30, default 10). ArtNet polls the network every "
+        "2.5 s and sends each universe directly to the nodes that reported an output on it, "
+        "as long as there are at most this many; with more, or none, the universe is "
+        "broadcast. 0 always broadcasts. Can be changed before or after init()."
+    );
+
+    QUERY->add_mfun(QUERY, dmx_artnet_nodes, "int", "artnetNodes");
+    QUERY->doc_func(QUERY,
+        "Returns the number of ArtNet nodes that answered the recent polls. Nodes that miss "
+        "three polls are dropped. 0 when ArtNet is not initialized."
+    );
+
     // --- Source Name ---
 
     QUERY->add_mfun(QUERY, dmx_get_name, "string", "name");
@@ -1485,5 +4393,59 @@ CK_DLL_QUERY(DMX) {
 
     QUERY->end_class(QUERY);
 
+    // ---------------- DMXOut ----------------
+
+    QUERY->begin_class(QUERY, "DMXOut", "UGen");
+    QUERY->doc_class(QUERY,
+        "Drives DMX channels from audio-rate signals. Each of the 8 inputs (connect with "
+        "=> dmxOut.chan(i)) is mapped to a (universe, channel) with map() and reduced over one "
+        "DMX frame period (1 / refreshRate() of the bound DMX) to a level: 0.0 -> 0, 1.0 -> 255. "
+        "Levels are written like channel() and go out on the next send(); in async mode DMXOut "
+        "publishes each frame itself. Audio passes through unchanged; connect DMXOut to "
+        "blackhole (or dac) so it is ticked."
+    );
+
+    QUERY->add_ctor(QUERY, dmxout_ctor);
+    QUERY->add_dtor(QUERY, dmxout_dtor);
+    QUERY->add_ugen_funcf(QUERY, dmxout_tickf, NULL, DMXOut::INPUTS, DMXOut::INPUTS);
+
+    QUERY->add_svar(QUERY, "int", "PEAK", TRUE, &dmxout_PEAK);
+    QUERY->doc_var(QUERY, "Decimation mode: largest absolute sample in each frame period (default).");
+    QUERY->add_svar(QUERY, "int", "MEAN", TRUE, &dmxout_MEAN);
+    QUERY->doc_var(QUERY, "Decimation mode: mean absolute sample over each frame period.");
+    QUERY->add_svar(QUERY, "int", "LAST", TRUE, &dmxout_LAST);
+    QUERY->doc_var(QUERY, "Decimation mode: last sample of each frame period.");
+
+    QUERY->add_mfun(QUERY, dmxout_dmx, "DMX", "dmx");
+    QUERY->add_arg(QUERY, "DMX", "dmx");
+    QUERY->doc_func(QUERY,
+        "Bind the DMX object whose frames this UGen writes. Nothing is written until a DMX is bound."
+    );
+
+    QUERY->add_mfun(QUERY, dmxout_map, "int", "map");
+    QUERY->add_arg(QUERY, "int", "input");
+    QUERY->add_arg(QUERY, "int", "universe");
+    QUERY->add_arg(QUERY, "int", "channel");
+    QUERY->doc_func(QUERY,
+        "Route input (0-7) to a DMX channel (1-512) on a universe. Writes to a universe that does "
+        "not exist are dropped. Returns 1 on success."
+    );
+
+    QUERY->add_mfun(QUERY, dmxout_unmap, "void", "unmap");
+    QUERY->add_arg(QUERY, "int", "input");
+    QUERY->doc_func(QUERY, "Stop writing input (0-7) to DMX.");
+
+    QUERY->add_mfun(QUERY, dmxout_get_mode, "int", "mode");
+    QUERY->doc_func(QUERY, "Get the decimation mode (DMXOut.PEAK, DMXOut.MEAN or DMXOut.LAST).");
+
+    QUERY->add_mfun(QUERY, dmxout_mode, "int", "mode");
+    QUERY->add_arg(QUERY, "int", "mode");
+    QUERY->doc_func(QUERY, "Set the decimation mode (DMXOut.PEAK, DMXOut.MEAN or DMXOut.LAST).");
+
+    dmxout_data_offset = QUERY->add_mvar(QUERY, "int", "@dmxout_data", false);
+    dmxout_ref_offset = QUERY->add_mvar(QUERY, "int", "@dmxout_dmx", false);
+
+    QUERY->end_class(QUERY);
+
     return TRUE;
 }
@@ -0,0 +1,72 @@
+// Steady-state allocation check for send(): counts every global operator new
+// while a 64-universe setup with running fades and a crossfade is sent
+// repeatedly, and compares it with DMX::allocations().
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target alloc_check
+//   ./build/bench/alloc_check [artnet]
+
+#include "../DMX.cpp"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> g_heap_allocs{ 0 };
+
+void* operator new(std::size_t size) {
+    g_heap_allocs.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+constexpr int UNIVERSES = 64;
+constexpr int SENDS = 2000;
+
+void steady_state(DMX& dmx, const char* label) {
+    unsigned char look[512];
+    for (int i = 0; i < 512; i++) look[i] = static_cast<unsigned char>(i);
+    // Warm up: first fades/crossfades allocate their per-universe state
+    for (int uni = 1; uni <= UNIVERSES; uni++) {
+        dmx.fade(uni, 1, 255, 60000);
+        dmx.fade(uni, 2, 0, 60000);
+    }
+    dmx.crossfade(2, look, 512, 60000);
+    for (int i = 0; i < 10; i++) dmx.send();
+
+    uint64_t heap0 = g_heap_allocs.load();
+    uint64_t dmx0 = dmx.allocations();
+    for (int i = 0; i < SENDS; i++) {
+        dmx.channel(1 + i % UNIVERSES, 10, i & 255);
+        dmx.send();
+    }
+    uint64_t heap = g_heap_allocs.load() - heap0;
+    uint64_t own = dmx.allocations() - dmx0;
+    std::printf("%-22s %d send() calls: %llu heap allocations, %llu counted by DMX::allocations()\n",
+                label, SENDS, static_cast<unsigned long long>(heap), static_cast<unsigned long long>(own));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    bool artnet = argc > 1 && std::strcmp(argv[1], "artnet") == 0;
+
+    DMX dmx;
+    for (int uni = 2; uni <= UNIVERSES; uni++) dmx.addUniverse(uni);
+    if (artnet) {
+        dmx.protocol(DMX::Protocol::ArtNet);
+        if (!dmx.init()) std::printf("ArtNet init failed; measuring without a transport\n");
+    }
+    std::printf("setup: %llu allocations counted by DMX::allocations()\n",
+                static_cast<unsigned long long>(dmx.allocations()));
+
+    steady_state(dmx, "sync");
+    dmx.async(true);
+    steady_state(dmx, "async");
+    dmx.async(false);
+    return 0;
+}
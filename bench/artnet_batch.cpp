@@ -0,0 +1,89 @@
+// ArtNet batching benchmark: sends frames of N universes (plus an ArtSync)
+// through libartnet one sendto() per packet, then queued and flushed per
+// frame (sendmmsg() where available), then through DMX::send(), and reports
+// packets/s and CPU time per frame for each. Packets are broadcast on the
+// chosen interface, so run it on an isolated network.
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target artnet_batch
+//   ./build/bench/artnet_batch [universes] [frames] [interface ip]
+
+#include "../DMX.cpp"
+
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <cstdlib>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Result {
+    double wall_s, cpu_s;
+};
+
+template <typename SendFrame>
+Result measure(int frames, SendFrame send_frame) {
+    std::clock_t cpu0 = std::clock();
+    auto t0 = Clock::now();
+    for (int f = 0; f < frames; f++) send_frame(f);
+    auto t1 = Clock::now();
+    std::clock_t cpu1 = std::clock();
+    return { std::chrono::duration<double>(t1 - t0).count(), double(cpu1 - cpu0) / CLOCKS_PER_SEC };
+}
+
+void report(const char* label, int universes, int frames, Result r) {
+    double packets = double(universes + 1) * frames;
+    std::printf("%-12s %9.0f packets/s   %7.1f us CPU per frame   %7.2f us CPU per packet\n",
+                label, packets / r.wall_s, r.cpu_s * 1e6 / frames, r.cpu_s * 1e6 / packets);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int universes = argc > 1 ? std::atoi(argv[1]) : 64;
+    int frames = argc > 2 ? std::atoi(argv[2]) : 500;
+    const char* ip = argc > 3 ? argv[3] : nullptr;
+    if (universes < 1 || universes > 512 || frames < 1) {
+        std::fprintf(stderr, "usage: artnet_batch [universes 1-512] [frames] [interface ip]\n");
+        return 1;
+    }
+
+    artnet_node node = artnet_new(ip, 0);
+    if (!node || artnet_set_node_type(node, ARTNET_SRV) || artnet_start(node)) {
+        std::fprintf(stderr, "artnet_batch: no usable interface: %s\n", artnet_strerror());
+        return 1;
+    }
+
+    uint8_t data[512];
+    uint8_t seq = 0;
+    auto send_universes = [&](int f) {
+        seq = seq == 255 ? 1 : seq + 1;
+        for (int u = 0; u < universes; u++) {
+            data[0] = static_cast<uint8_t>(f + u);
+            artnet_send_dmx_addr(node, static_cast<uint16_t>(u), seq, 512, data);
+        }
+        artnet_send_sync(node);
+    };
+
+    std::printf("%d universes + ArtSync, %d frames\n", universes, frames);
+    report("sendto", universes, frames, measure(frames, send_universes));
+    report("batched", universes, frames, measure(frames, [&](int f) {
+        artnet_batch_begin(node);
+        send_universes(f);
+        artnet_batch_flush(node);
+    }));
+    artnet_destroy(node);
+
+    // End to end: every universe changes each frame, so each send() carries all of them
+    DMX dmx;
+    dmx.protocol(DMX::Protocol::ArtNet);
+    for (int u = 2; u <= universes; u++) dmx.addUniverse(u);
+    dmx.artnetSync(true);
+    if (!dmx.init()) return 1;
+    report("DMX::send()", universes, frames, measure(frames, [&](int f) {
+        for (int u = 1; u <= universes; u++) dmx.channel(u, 1, (f + u) & 255);
+        dmx.send();
+    }));
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Raw serial break timing harness: drives the raw (OpenDMX-style) writer into
+// a pseudo-terminal and reports the achieved break, Mark After Break and
+// frame period for each break strategy, next to the usleep() timing the raw
+// path used before. A pty has no UART, so break/MAB are measured around the
+// writer's syscalls and the period at the reading end. Linux only.
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target break_timing
+//   ./build/bench/break_timing [load]     # "load" adds one busy thread per core
+
+#include "../DMX.cpp"
+
+#include <pty.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+struct DMXBench {
+    static SerialWriter* writer(DMX& dmx) { return dmx._serial_outputs.front().writer.get(); }
+};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int FRAMES = 400;
+
+struct Percentiles {
+    double mean, p50, p99, max;
+};
+
+Percentiles summarize(std::vector<double> v) {
+    if (v.empty()) return { 0, 0, 0, 0 };
+    std::sort(v.begin(), v.end());
+    double sum = 0;
+    for (double x : v) sum += x;
+    return { sum / v.size(), v[v.size() / 2], v[v.size() * 99 / 100], v.back() };
+}
+
+// What the raw path did before: usleep(120) break, usleep(12) MAB
+void legacy_sleeps() {
+    std::vector<double> brk, mab;
+    for (int i = 0; i < FRAMES; i++) {
+        auto t0 = Clock::now();
+        usleep(120);
+        auto t1 = Clock::now();
+        usleep(12);
+        auto t2 = Clock::now();
+        brk.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+        mab.push_back(std::chrono::duration<double, std::micro>(t2 - t1).count());
+    }
+    Percentiles b = summarize(brk), m = summarize(mab);
+    std::printf("%-12s break mean %7.1f p99 %7.1f max %7.1f us   MAB mean %7.1f p99 %7.1f max %7.1f us\n",
+                "usleep", b.mean, b.p99, b.max, m.mean, m.p99, m.max);
+}
+
+void run(int mode, const char* label) {
+    int master, slave;
+    char name[128];
+    if (openpty(&master, &slave, name, nullptr, nullptr) < 0) {
+        std::perror("openpty");
+        return;
+    }
+    close(slave); // the writer opens the slave by name
+
+    DMX dmx;
+    dmx.protocol(DMX::Protocol::Serial_Raw);
+    dmx.port(name);
+    if (!dmx.breakMode(mode) || !dmx.init()) {
+        std::printf("%-12s unavailable\n", label);
+        close(master);
+        return;
+    }
+    const size_t frame_bytes = 513 + (mode == 1 ? 1 : 0); // BREAK_BAUD adds its 0x00 byte
+
+    // Reader: timestamp each completed frame at the far end of the pty
+    std::vector<Clock::time_point> arrivals;
+    arrivals.reserve(FRAMES + 1);
+    std::atomic<bool> done{ false };
+    std::thread reader([&] {
+        unsigned char buf[8192];
+        size_t total = 0;
+        while (!done.load()) {
+            pollfd pfd{ master, POLLIN, 0 };
+            if (poll(&pfd, 1, 20) <= 0) continue;
+            ssize_t n = read(master, buf, sizeof(buf));
+            if (n <= 0) continue;
+            size_t before = total / frame_bytes;
+            total += static_cast<size_t>(n);
+            auto now = Clock::now();
+            for (size_t f = before; f < total / frame_bytes; f++) arrivals.push_back(now);
+        }
+    });
+
+    // Back-to-back sends: the writer runs flat out, so the period is its own cycle time
+    for (int i = 0; i < FRAMES; i++) {
+        dmx.channel(1, i & 255);
+        dmx.send();
+        while (DMXBench::writer(dmx)->framesWritten() < static_cast<uint64_t>(i + 1))
+            std::this_thread::yield();
+    }
+    usleep(50000);
+    done = true;
+    reader.join();
+
+    SerialWriter::BreakTiming t = DMXBench::writer(dmx)->breakTiming();
+    std::vector<double> periods;
+    for (size_t i = 1; i < arrivals.size(); i++)
+        periods.push_back(std::chrono::duration<double, std::micro>(arrivals[i] - arrivals[i - 1]).count());
+    Percentiles p = summarize(periods);
+    std::printf("%-12s break mean %7.1f max %7.1f us   MAB mean %7.1f max %7.1f us   "
+                "period mean %7.1f p99 %7.1f max %7.1f us (%llu frames)\n",
+                label, t.break_us_total / std::max<uint64_t>(t.frames, 1), t.break_us_max,
+                t.mab_us_total / std::max<uint64_t>(t.frames, 1), t.mab_us_max, p.mean, p.p99, p.max,
+                static_cast<unsigned long long>(t.frames));
+    close(master);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::thread> load;
+    std::atomic<bool> stop{ false };
+    if (argc > 1 && std::strcmp(argv[1], "load") == 0) {
+        for (unsigned i = 0; i < std::thread::hardware_concurrency(); i++)
+            load.emplace_back([&] { while (!stop.load(std::memory_order_relaxed)) {} });
+        std::printf("with %zu busy threads\n", load.size());
+    }
+
+    legacy_sleeps();
+    run(0, "BREAK_IOCTL");
+    run(1, "BREAK_BAUD");
+
+    stop = true;
+    for (auto& t : load) t.join();
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Whole-universe crossfade benchmark: crossfade() and its vector blend kernel
+// versus driving the same transition with 512 per-channel fade() calls.
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target crossfade_bench
+//   ./build/bench/crossfade_bench
+
+#include "../DMX.cpp"
+
+#include <chrono>
+#include <cstdio>
+
+struct DMXBench {
+    static void update_fades(DMX& dmx) { dmx.update_fades(); }
+};
+
+namespace {
+
+constexpr int UNIVERSES = 64;
+constexpr int DURATION_MS = 3600 * 1000; // long enough not to finish mid-run
+
+template <typename Fn>
+double ns_per_call(int iterations, Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+}
+
+const char* kernel_name() {
+#if defined(DMX_BLEND_AVX2)
+    return "avx2";
+#elif defined(DMX_BLEND_SSE2)
+    return "sse2";
+#elif defined(DMX_BLEND_NEON)
+    return "neon";
+#else
+    return "scalar";
+#endif
+}
+
+void bench_kernel() {
+    alignas(32) uint8_t from[512], to[512], out[512];
+    for (int i = 0; i < 512; i++) {
+        from[i] = static_cast<uint8_t>(i);
+        to[i] = static_cast<uint8_t>(255 - i);
+    }
+    const int iterations = 2000000;
+    unsigned w = 0;
+    volatile uint8_t sink = 0;
+    double scalar_ns = ns_per_call(iterations, [&] {
+        blend_frame_scalar(from, to, out, 512, (w++) & 255);
+        sink = sink + out[w & 511];
+    });
+    double vector_ns = ns_per_call(iterations, [&] {
+        blend_frame(from, to, out, 512, (w++) & 255);
+        sink = sink + out[w & 511];
+    });
+    std::printf("blend kernel, 512 ch: scalar %6.1f ns (%5.2f GB/s)   %s %6.1f ns (%5.2f GB/s)   (%.1fx)\n",
+                scalar_ns, 512.0 / scalar_ns, kernel_name(), vector_ns, 512.0 / vector_ns,
+                scalar_ns / vector_ns);
+}
+
+void bench_universes() {
+    unsigned char look[512];
+    for (int i = 0; i < 512; i++) look[i] = static_cast<unsigned char>(255 - (i & 255));
+
+    DMX per_channel;
+    DMX whole;
+    for (int uni = 2; uni <= UNIVERSES; uni++) {
+        per_channel.addUniverse(uni);
+        whole.addUniverse(uni);
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    for (int uni = 1; uni <= UNIVERSES; uni++)
+        for (int ch = 1; ch <= 512; ch++) per_channel.fade(uni, ch, look[ch - 1], DURATION_MS);
+    auto t1 = std::chrono::steady_clock::now();
+    for (int uni = 1; uni <= UNIVERSES; uni++) whole.crossfade(uni, look, 512, DURATION_MS);
+    auto t2 = std::chrono::steady_clock::now();
+
+    const int iterations = 2000;
+    double fade_ns = ns_per_call(iterations, [&] { DMXBench::update_fades(per_channel); });
+    double xfade_ns = ns_per_call(iterations, [&] { DMXBench::update_fades(whole); });
+
+    std::printf("%d universes start:  fade() x512 %9.1f us   crossfade() %7.1f us\n", UNIVERSES,
+                std::chrono::duration<double, std::micro>(t1 - t0).count(),
+                std::chrono::duration<double, std::micro>(t2 - t1).count());
+    std::printf("%d universes update: fade() x512 %9.1f us   crossfade() %7.1f us   (%.1fx, %.0f Mch/s)\n",
+                UNIVERSES, fade_ns / 1000.0, xfade_ns / 1000.0, fade_ns / xfade_ns,
+                UNIVERSES * 512.0 / xfade_ns * 1000.0);
+}
+
+} // namespace
+
+int main() {
+    bench_kernel();
+    bench_universes();
+    return 0;
+}
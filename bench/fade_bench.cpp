@@ -0,0 +1,95 @@
+// Fade stepping micro-benchmark: the active-fade list used by DMX versus the
+// previous per-universe 512-slot scan, with 64 universes and a few running fades.
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target fade_bench
+//   ./build/bench/fade_bench
+
+#include "../DMX.cpp"
+
+#include <chrono>
+#include <cstdio>
+
+struct DMXBench {
+    static void update_fades(DMX& dmx) { dmx.update_fades(); }
+};
+
+namespace {
+
+constexpr int UNIVERSES = 64;
+constexpr int ITERATIONS = 20000;
+
+// Pre-list fade state: one slot per channel, scanned in full for every
+// universe that has at least one fade running.
+struct LegacyFade {
+    bool active;
+    unsigned char start_value;
+    unsigned char target_value;
+    std::chrono::steady_clock::time_point start_time;
+    std::chrono::milliseconds duration;
+};
+
+struct LegacyUniverse {
+    int active_fade_count{ 0 };
+    LegacyFade fades[513]{};
+    unsigned char dmx_data[513]{};
+};
+
+void legacy_update(std::vector<LegacyUniverse>& universes) {
+    auto now = std::chrono::steady_clock::now();
+    for (auto& u : universes) {
+        if (u.active_fade_count == 0) continue;
+        for (int ch = 1; ch <= 512; ch++) {
+            LegacyFade& f = u.fades[ch];
+            if (!f.active) continue;
+            auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - f.start_time);
+            if (elapsed >= f.duration) {
+                u.dmx_data[ch] = f.target_value;
+                f.active = false;
+                u.active_fade_count--;
+            } else {
+                double t = static_cast<double>(elapsed.count()) / static_cast<double>(f.duration.count());
+                u.dmx_data[ch] = static_cast<unsigned char>(
+                    f.start_value + static_cast<int>(t * (f.target_value - f.start_value)));
+            }
+        }
+    }
+}
+
+template <typename Fn>
+double ns_per_call(Fn&& fn) {
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ITERATIONS; i++) fn();
+    auto t1 = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(t1 - t0).count() / ITERATIONS;
+}
+
+void run(int fades) {
+    const int duration_ms = 3600 * 1000; // long enough not to finish mid-run
+
+    std::vector<LegacyUniverse> legacy(UNIVERSES);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < fades; i++) {
+        LegacyUniverse& u = legacy[i % UNIVERSES];
+        LegacyFade& f = u.fades[1 + (i * 37) % 512];
+        f = { true, 0, 255, start, std::chrono::milliseconds(duration_ms) };
+        u.active_fade_count++;
+    }
+
+    DMX dmx;
+    for (int uni = 2; uni <= UNIVERSES; uni++) dmx.addUniverse(uni);
+    for (int i = 0; i < fades; i++)
+        dmx.fade(1 + i % UNIVERSES, 1 + (i * 37) % 512, 255, duration_ms);
+
+    double legacy_ns = ns_per_call([&] { legacy_update(legacy); });
+    double list_ns = ns_per_call([&] { DMXBench::update_fades(dmx); });
+
+    std::printf("%3d universes, %3d fades: scan %9.1f ns/update   list %7.1f ns/update   (%.1fx)\n",
+                UNIVERSES, fades, legacy_ns, list_ns, legacy_ns / list_ns);
+}
+
+} // namespace
+
+int main() {
+    for (int fades : { 0, 1, 4, 8, 16, 64 }) run(fades);
+    return 0;
+}
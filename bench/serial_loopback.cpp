@@ -0,0 +1,308 @@
+// Serial loopback harness: points DMX at the slave end of a pseudo-terminal,
+// decodes what arrives at the master end and reports frames/s, bytes/s,
+// send()-to-wire latency percentiles and dropped frames for each serial mode.
+// Each frame carries a sequence number in channels 1-4 and a pattern derived
+// from it in the rest, so corrupted or reordered frames are caught as well;
+// the exit status is non-zero if any were, which makes this usable as a
+// regression gate for serial changes. A last pass runs each mode under
+// pacing() while send() is called flat out and reports the frame spacing seen
+// on the wire next to pacedRate()/pacingJitter(). Linux only.
+//
+//   cmake -S . -B build -DDMX_BUILD_BENCHMARKS=ON && cmake --build build --target serial_loopback
+//   ./build/bench/serial_loopback [slots]      # slots per frame, default 512
+
+#include "../DMX.cpp"
+
+#include <pty.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+struct DMXBench {
+    static SerialWriter* writer(DMX& dmx) { return dmx._serial_outputs.front().writer.get(); }
+};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int FLAT_OUT_MS = 2000;   // send() as fast as possible
+constexpr int PACED_FRAMES = 400;   // then send() at PACED_HZ
+constexpr int PACED_HZ = 200;
+constexpr uint32_t MAX_SEQ = 1u << 22;
+constexpr double PACING_HZ = 44;
+constexpr int PACING_MS = 3000;
+
+struct Mode {
+    const char* name;
+    DMX::Protocol protocol;
+    int break_mode;
+};
+
+unsigned char pattern(uint32_t seq, int ch) {
+    return static_cast<unsigned char>((seq * 31 + ch * 7) & 0xFF);
+}
+
+// Decodes the master side of the pty. Raw frames have no visible break on a
+// pty, so they are split by their fixed length (plus the 0x00 break byte in
+// BREAK_BAUD mode); Enttec frames are parsed message by message.
+class Decoder {
+public:
+    Decoder(bool enttec, int slots, int lead) : _enttec(enttec), _slots(slots), _lead(lead) {}
+
+    // Returns false once a frame fails to decode
+    bool feed(const unsigned char* p, size_t n, Clock::time_point now) {
+        _buf.insert(_buf.end(), p, p + n);
+        bytes += n;
+        size_t pos = 0;
+        while (true) {
+            const unsigned char* payload; // start code + slots
+            size_t used;
+            if (_enttec) {
+                if (_buf.size() - pos < 4) break;
+                if (_buf[pos] != 0x7E) return fail("Enttec start byte");
+                size_t len = _buf[pos + 2] | (_buf[pos + 3] << 8);
+                if (_buf.size() - pos < 5 + len) break;
+                if (_buf[pos + 4 + len] != 0xE7) return fail("Enttec end byte");
+                used = 5 + len;
+                if (_buf[pos + 1] != 0x06) { pos += used; continue; } // not a DMX frame
+                if (len != static_cast<size_t>(1 + _slots)) return fail("Enttec length");
+                payload = &_buf[pos + 4];
+            }
+            else {
+                used = _lead + 1 + _slots;
+                if (_buf.size() - pos < used) break;
+                if (_lead && _buf[pos] != 0x00) return fail("break byte");
+                payload = &_buf[pos + _lead];
+            }
+            if (!check(payload, now)) return false;
+            pos += used;
+        }
+        _buf.erase(_buf.begin(), _buf.begin() + pos);
+        return true;
+    }
+
+    std::vector<std::pair<uint32_t, Clock::time_point>> arrivals;
+    std::vector<Clock::time_point> frames; // every decoded frame, repeats included
+    size_t bytes{ 0 };
+    const char* error{ nullptr };
+
+private:
+    bool _enttec;
+    int _slots;
+    int _lead;
+    std::vector<unsigned char> _buf;
+    uint32_t _last_seq{ 0 };
+
+    bool fail(const char* what) {
+        error = what;
+        return false;
+    }
+
+    bool check(const unsigned char* f, Clock::time_point now) {
+        if (f[0] != 0x00) return fail("start code");
+        uint32_t seq = f[1] | (f[2] << 8) | (f[3] << 16) | (static_cast<uint32_t>(f[4]) << 24);
+        if (seq == 0 || seq >= MAX_SEQ) return fail("sequence number");
+        if (seq < _last_seq) return fail("frame order");
+        for (int ch = 5; ch <= _slots; ch++)
+            if (f[ch] != pattern(seq, ch)) return fail("payload");
+        // The same frame may legitimately go out twice (keep-alive, hotplug resend)
+        if (seq != _last_seq) arrivals.emplace_back(seq, now);
+        frames.push_back(now);
+        _last_seq = seq;
+        return true;
+    }
+};
+
+double percentile(std::vector<double>& v, double p) {
+    if (v.empty()) return 0;
+    return v[std::min(v.size() - 1, static_cast<size_t>(p * v.size()))];
+}
+
+// Owns the pty master; declared ahead of the DMX so it closes after the writers stop
+struct PtyMaster {
+    int fd{ -1 };
+    ~PtyMaster() {
+        if (fd >= 0) close(fd);
+    }
+};
+
+// DMX on the slave end of a pty, with a thread decoding the master end
+class Loopback {
+    PtyMaster _master;
+
+public:
+    Loopback(const Mode& mode, int slots)
+        : decoder(mode.protocol == DMX::Protocol::Serial, slots, mode.break_mode == 1 ? 1 : 0),
+          _mode(mode), _slots(slots), _sent(MAX_SEQ) {}
+
+    ~Loopback() {
+        if (_reader.joinable()) stop();
+    }
+
+    // Returns false (after printing why) if the mode cannot run here
+    bool start() {
+        int slave;
+        char name[128];
+        if (openpty(&_master.fd, &slave, name, nullptr, nullptr) < 0) {
+            std::perror("openpty");
+            return false;
+        }
+        close(slave); // DMX opens the slave by name
+        dmx.protocol(_mode.protocol);
+        dmx.port(name);
+        dmx.minSlots(_slots);
+        if (_mode.break_mode >= 0 && !dmx.breakMode(_mode.break_mode)) {
+            std::printf("%-20s unavailable\n", _mode.name);
+            return false;
+        }
+        if (!dmx.init()) {
+            std::printf("%-20s init failed\n", _mode.name);
+            return false;
+        }
+        _reader = std::thread([this] {
+            unsigned char buf[16384];
+            while (!_done.load()) {
+                pollfd pfd{ _master.fd, POLLIN, 0 };
+                if (poll(&pfd, 1, 20) <= 0) continue;
+                ssize_t n = read(_master.fd, buf, sizeof(buf));
+                if (n <= 0) continue;
+                if (_ok && !decoder.feed(buf, static_cast<size_t>(n), Clock::now())) _ok = false;
+            }
+        });
+        return true;
+    }
+
+    // Lets the wire drain, stops decoding; false (after printing why) on a decode error
+    bool stop() {
+        usleep(100000);
+        _done = true;
+        _reader.join();
+        if (!_ok) std::printf("%-20s DECODE ERROR: %s\n", _mode.name, decoder.error);
+        return _ok;
+    }
+
+    void send() {
+        seq++;
+        unsigned char frame[512];
+        frame[0] = seq & 0xFF;
+        frame[1] = (seq >> 8) & 0xFF;
+        frame[2] = (seq >> 16) & 0xFF;
+        frame[3] = (seq >> 24) & 0xFF;
+        for (int ch = 5; ch <= _slots; ch++) frame[ch - 1] = pattern(seq, ch);
+        dmx.frame(1, frame, _slots);
+        _sent[seq] = Clock::now();
+        dmx.send();
+    }
+
+    Clock::time_point sent(uint32_t s) const { return _sent[s]; }
+
+    DMX dmx;
+    Decoder decoder;
+    uint32_t seq{ 0 };
+
+private:
+    const Mode& _mode;
+    int _slots;
+    std::vector<Clock::time_point> _sent;
+    std::thread _reader;
+    std::atomic<bool> _done{ false };
+    std::atomic<bool> _ok{ true };
+};
+
+bool run(const Mode& mode, int slots) {
+    Loopback loop(mode, slots);
+    if (!loop.start()) return mode.break_mode >= 0; // a missing break mode is not a failure
+    SerialWriter* writer = DMXBench::writer(loop.dmx);
+
+    auto t0 = Clock::now();
+    while (Clock::now() - t0 < std::chrono::milliseconds(FLAT_OUT_MS) && loop.seq < MAX_SEQ / 2) loop.send();
+    uint32_t flat_out_last = loop.seq;
+    usleep(50000);
+    for (int i = 0; i < PACED_FRAMES; i++) {
+        loop.send();
+        dmx_sleep_until(loop.sent(loop.seq) + std::chrono::microseconds(1000000 / PACED_HZ));
+    }
+    if (!loop.stop()) return false;
+    const Decoder& decoder = loop.decoder;
+
+    std::vector<double> flat_lat, paced_lat;
+    size_t flat_frames = 0;
+    Clock::time_point first{}, last{};
+    for (auto& a : decoder.arrivals) {
+        double us = std::chrono::duration<double, std::micro>(a.second - loop.sent(a.first)).count();
+        if (a.first <= flat_out_last) {
+            if (flat_frames++ == 0) first = a.second;
+            last = a.second;
+            flat_lat.push_back(us);
+        }
+        else {
+            paced_lat.push_back(us);
+        }
+    }
+    std::sort(flat_lat.begin(), flat_lat.end());
+    std::sort(paced_lat.begin(), paced_lat.end());
+    double secs = std::chrono::duration<double>(last - first).count();
+    uint64_t paced_missing = PACED_FRAMES - paced_lat.size();
+
+    std::printf("%-20s %7.0f frames/s %6.2f MB/s   flat-out latency p50 %6.0f p99 %6.0f us   "
+                "paced %d Hz p50 %5.0f p99 %5.0f max %5.0f us   coalesced %llu   paced lost %llu\n",
+                mode.name, secs > 0 ? flat_frames / secs : 0.0,
+                secs > 0 ? decoder.bytes / secs / 1e6 : 0.0,
+                percentile(flat_lat, 0.5), percentile(flat_lat, 0.99), PACED_HZ,
+                percentile(paced_lat, 0.5), percentile(paced_lat, 0.99),
+                paced_lat.empty() ? 0.0 : paced_lat.back(),
+                static_cast<unsigned long long>(writer->framesDropped()),
+                static_cast<unsigned long long>(paced_missing));
+    return paced_missing == 0;
+}
+
+// send() flat out under pacing(PACING_HZ): the wire should see a steady PACING_HZ
+bool run_pacing(const Mode& mode, int slots) {
+    Loopback loop(mode, slots);
+    if (!loop.start()) return mode.break_mode >= 0;
+    loop.dmx.pacing(PACING_HZ, 0);
+
+    auto t0 = Clock::now();
+    while (Clock::now() - t0 < std::chrono::milliseconds(PACING_MS) && loop.seq < MAX_SEQ / 2) loop.send();
+    double reported_rate = loop.dmx.pacedRate();
+    double reported_jitter = loop.dmx.pacingJitter();
+    if (!loop.stop()) return false;
+
+    // Skip the first frames while the grid settles
+    const auto& frames = loop.decoder.frames;
+    std::vector<double> periods;
+    for (size_t i = 5; i < frames.size(); i++)
+        periods.push_back(std::chrono::duration<double, std::micro>(frames[i] - frames[i - 1]).count());
+    std::sort(periods.begin(), periods.end());
+    double span = frames.size() > 5 ? std::chrono::duration<double>(frames.back() - frames[4]).count() : 0;
+    double wire_rate = span > 0 ? (frames.size() - 5) / span : 0;
+    std::printf("%-20s paced %.0f Hz: wire %6.2f frames/s, period p1 %6.0f p50 %6.0f p99 %6.0f us   "
+                "pacedRate() %6.2f   pacingJitter() %5.1f us\n",
+                mode.name, PACING_HZ, wire_rate, percentile(periods, 0.01), percentile(periods, 0.5),
+                percentile(periods, 0.99), reported_rate, reported_jitter);
+    // The writer must hold the rate however fast send() is called
+    return wire_rate > PACING_HZ * 0.95 && wire_rate < PACING_HZ * 1.05;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    int slots = argc > 1 ? std::atoi(argv[1]) : 512;
+    if (slots < 4 || slots > 512) {
+        std::fprintf(stderr, "slots must be 4-512\n");
+        return 2;
+    }
+    const Mode modes[] = {
+        { "SERIAL (Enttec)", DMX::Protocol::Serial, -1 },
+        { "SERIAL_RAW ioctl", DMX::Protocol::Serial_Raw, 0 },
+        { "SERIAL_RAW baud", DMX::Protocol::Serial_Raw, 1 },
+    };
+    std::printf("%d slots per frame\n", slots);
+    bool ok = true;
+    for (const Mode& mode : modes) ok = run(mode, slots) && ok;
+    for (const Mode& mode : modes) ok = run_pacing(mode, slots) && ok;
+    return ok ? 0 : 1;
+}
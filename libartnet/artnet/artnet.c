@@ -64,7 +64,8 @@ uint16_t LOW_BYTE = 0x00FF;
 uint16_t HIGH_BYTE = 0xFF00;
 
 void copy_apr_to_node_entry(artnet_node_entry e, artnet_reply_t *reply);
-int find_nodes_from_uni(node_list_t *nl, uint8_t uni, SI *ips, int size);
+int reindex_subscribers(node n);
+int find_subscribers(node n, uint16_t address, const subscriber_t **first);
 
 /*
  * Creates a new ArtNet node.
@@ -210,6 +211,7 @@ int artnet_destroy(artnet_node vn) {
     tmp = ent->next;
     free(ent);
   }
+  free(n->subscribers.entries);
 
   for (i =0; i < ARTNET_MAX_PORTS; i++) {
     flush_tod(&n->ports.in[i].port_tod);
@@ -648,35 +650,20 @@ int artnet_send_dmx(artnet_node vn,
     if ((ret = artnet_net_send(n, &p)))
       return ret;
   } else {
-    int nodes;
-    // find the number of ports for this uni
-    SI *ips = malloc(sizeof(SI) * n->state.bcast_limit);
-
-    if (!ips) {
-      // Fallback to broadcast mode
-      if ((ret = artnet_net_send(n, &p)))
-        return ret;
-    }
-
-    nodes = find_nodes_from_uni(&n->node_list,
-                                port->port_addr,
-                                ips,
-                                n->state.bcast_limit);
+    const subscriber_t *subs;
+    int nodes = find_subscribers(n, port->port_addr, &subs);
 
     if (nodes > n->state.bcast_limit) {
       // fall back to broadcast
-      free(ips);
-      if ((ret = artnet_net_send(n, &p))) {
+      if ((ret = artnet_net_send(n, &p)))
         return ret;
-      }
     } else {
       // unicast to the specified nodes
       int i;
-      for (i =0; i < nodes; i++) {
-        p.to = ips[i];
+      for (i = 0; i < nodes; i++) {
+        p.to = subs[i].ip;
         artnet_net_send(n, &p);
       }
-      free(ips);
     }
   }
   port->seq++;
@@ -732,6 +719,143 @@ int artnet_raw_send_dmx(artnet_node vn,
 }
 
 
+/*
+ * Sends dmx data to a 15 bit Port-Address (Net:SubNet:Universe, Art-Net 3
+ * and later). Unlike artnet_send_dmx() this is not tied to the node's four
+ * ports, so one node can drive any number of universes. The caller keeps
+ * the sequence number for each Port-Address (0 disables sequencing).
+ *
+ * @param vn the artnet_node
+ * @param address the Port-Address, 0 - 32767
+ * @param sequence the ArtDmx sequence number
+ * @param length the length of the dmx data
+ * @param data the dmx data
+ */
+int artnet_send_dmx_addr(artnet_node vn,
+                         uint16_t address,
+                         uint8_t sequence,
+                         int16_t length,
+                         const uint8_t *data) {
+  node n = (node) vn;
+  artnet_packet_t p;
+
+  check_nullnode(vn);
+
+  if (n->state.mode != ARTNET_ON)
+    return ARTNET_EACTION;
+
+  if (address > ARTNET_MAX_PORT_ADDR) {
+    artnet_error("%s : Port-Address out of bounds (%i > %i)", __FUNCTION__, address, ARTNET_MAX_PORT_ADDR);
+    return ARTNET_EARG;
+  }
+
+  if (length < 1 || length > ARTNET_DMX_LENGTH) {
+    artnet_error("%s : Length of dmx data out of bounds (%i < 1 || %i > ARTNET_MAX_DMX)", __FUNCTION__, length);
+    return ARTNET_EARG;
+  }
+
+  p.length = sizeof(artnet_dmx_t) - (ARTNET_DMX_LENGTH - length);
+
+  // now build packet; SubUni is the low byte of the Port-Address, Net the high
+  memcpy(&p.data.admx.id, ARTNET_STRING, ARTNET_STRING_SIZE);
+  p.data.admx.opCode = htols(ARTNET_DMX);
+  p.data.admx.verH = 0;
+  p.data.admx.ver = ARTNET_VERSION;
+  p.data.admx.sequence = sequence;
+  p.data.admx.physical = 0;
+  p.data.admx.universe = htols(address);
+
+  // set length
+  p.data.admx.lengthHi = short_get_high_byte(length);
+  p.data.admx.length = short_get_low_byte(length);
+  memcpy(&p.data.admx.data, data, length);
+
+  // unicast to the nodes that reported an output on this Port-Address, as
+  // long as there are at most bcast_limit of them. Broadcast when nobody
+  // has, so receivers that never answered a poll still get the data.
+  if (n->state.bcast_limit > 0) {
+    const subscriber_t *subs;
+    int nodes = find_subscribers(n, address, &subs);
+
+    if (nodes > 0 && nodes <= n->state.bcast_limit) {
+      int i, ret = ARTNET_EOK;
+      for (i = 0; i < nodes; i++) {
+        p.to = subs[i].ip;
+        if (artnet_net_send(n, &p))
+          ret = ARTNET_ENET;
+      }
+      return ret;
+    }
+  }
+
+  p.to.s_addr = n->state.bcast_addr.s_addr;
+  return artnet_net_send(n, &p);
+}
+
+
+/*
+ * Sends an ArtSync, so receivers in synchronous mode output the universes
+ * sent since the last one together. Send it after the ArtDmx packets of a
+ * frame.
+ *
+ * @param vn the artnet_node
+ */
+int artnet_send_sync(artnet_node vn) {
+  node n = (node) vn;
+  check_nullnode(vn);
+
+  if (n->state.mode != ARTNET_ON)
+    return ARTNET_EACTION;
+
+  return artnet_tx_sync(n);
+}
+
+
+/*
+ * Starts a batch: the packets this node sends are queued instead of going
+ * out one sendto() at a time, until artnet_batch_flush() sends them all
+ * together (with a single sendmmsg() call where available). Use it around
+ * the artnet_send_dmx_addr() and artnet_send_sync() calls of one frame;
+ * their return values then only report argument errors.
+ *
+ * @param vn the artnet_node
+ */
+int artnet_batch_begin(artnet_node vn) {
+  node n = (node) vn;
+  check_nullnode(vn);
+
+  if (n->state.mode != ARTNET_ON)
+    return ARTNET_EACTION;
+
+  n->batch.active = TRUE;
+  n->batch.failed = FALSE;
+  return ARTNET_EOK;
+}
+
+
+/*
+ * Sends the packets queued since artnet_batch_begin() and ends the batch.
+ *
+ * @param vn the artnet_node
+ * @return 0 if every packet of the batch was sent, ARTNET_ENET otherwise
+ */
+int artnet_batch_flush(artnet_node vn) {
+  node n = (node) vn;
+  int ret;
+  check_nullnode(vn);
+
+  n->batch.active = FALSE;
+  if (n->state.mode != ARTNET_ON) {
+    n->batch.count = 0;
+    return ARTNET_EACTION;
+  }
+
+  ret = artnet_net_flush(n);
+  return n->batch.failed ? ARTNET_ENET : ret;
+}
+
+
+
 
 int artnet_send_address(artnet_node vn,
                         artnet_node_entry e,
@@ -1491,6 +1615,54 @@ int artnet_nl_get_length(artnet_node_list vnl) {
 }
 
 
+/*
+ * Removes the nodes that haven't sent an ArtPollReply for the given number
+ * of seconds, so that unicast stops once a node has gone. Call it between
+ * polls; any artnet_node_entry taken from the list before may be freed.
+ *
+ * @param vn the artnet_node
+ * @param seconds the age after which a node is dropped
+ * @return the number of nodes removed
+ */
+int artnet_nl_expire(artnet_node vn, int seconds) {
+  node n = (node) vn;
+  node_list_t *nl;
+  node_entry_private_t *ent, *prev = NULL, *next;
+  time_t now = time(NULL);
+  int removed = 0;
+
+  check_nullnode(vn);
+  nl = &n->node_list;
+
+  for (ent = nl->first; ent != NULL; ent = next) {
+    next = ent->next;
+    if (now - ent->last_seen < seconds) {
+      prev = ent;
+      continue;
+    }
+
+    if (prev)
+      prev->next = next;
+    else
+      nl->first = next;
+    if (nl->last == ent)
+      nl->last = prev;
+    if (nl->current == ent)
+      nl->current = NULL;
+
+    if (ent->firmware.data != NULL)
+      free(ent->firmware.data);
+    free(ent);
+    nl->length--;
+    removed++;
+  }
+
+  if (removed)
+    reindex_subscribers(n);
+  return removed;
+}
+
+
 /*
  * Return a pointer to the staticly allocated error string
  */
@@ -1503,8 +1675,10 @@ char *artnet_strerror() {
 // Private functions follow
 //-----------------------------------------------------------------------------
 
-int artnet_nl_update(node_list_t *nl, artnet_packet reply) {
+int artnet_nl_update(node n, artnet_packet reply) {
+  node_list_t *nl = &n->node_list;
   node_entry_private_t *entry;
+  artnet_node_entry_t old;
 
   entry = find_entry_from_ip(nl, reply->from);
 
@@ -1521,6 +1695,7 @@ int artnet_nl_update(node_list_t *nl, artnet_packet reply) {
 
     copy_apr_to_node_entry(&entry->pub, &reply->data.ar);
     entry->ip = reply->from;
+    entry->last_seen = time(NULL);
     entry->next = NULL;
 
     if (!nl->first) {
@@ -1531,10 +1706,19 @@ int artnet_nl_update(node_list_t *nl, artnet_packet reply) {
       nl->last = entry;
     }
     nl->length++;
-  } else {
-    // update entry
-    copy_apr_to_node_entry(&entry->pub, &reply->data.ar);
+    return reindex_subscribers(n);
   }
+
+  // update entry, reindexing only if its outputs moved
+  old = entry->pub;
+  copy_apr_to_node_entry(&entry->pub, &reply->data.ar);
+  entry->last_seen = time(NULL);
+
+  if (old.sub != entry->pub.sub
+      || old.numbports != entry->pub.numbports
+      || memcmp(old.porttypes, entry->pub.porttypes, ARTNET_MAX_PORTS)
+      || memcmp(old.swout, entry->pub.swout, ARTNET_MAX_PORTS))
+    return reindex_subscribers(n);
   return ARTNET_EOK;
 }
 
@@ -1553,32 +1737,99 @@ node_entry_private_t *find_entry_from_ip(node_list_t *nl, SI ip) {
 }
 
 
+int compare_subscribers(const void *a, const void *b) {
+  const subscriber_t *x = (const subscriber_t*) a;
+  const subscriber_t *y = (const subscriber_t*) b;
+
+  if (x->addr != y->addr)
+    return x->addr < y->addr ? -1 : 1;
+  if (x->ip.s_addr != y->ip.s_addr)
+    return x->ip.s_addr < y->ip.s_addr ? -1 : 1;
+  return 0;
+}
+
+
 /*
- * Find all nodes with a port bound to a particular universe
- * @param nl the node list
- * @param uni the universe to search for
- * @param ips store matching node ips here
- * @param size size of ips
- * @return number of nodes matched
+ * Rebuild the subscriber index from the node list: one entry for each
+ * output port (Port-Address = Net and SubNet from the reply, Universe from
+ * the low nibble of SwOut), sorted, with a node's duplicate ports merged.
+ * The index only grows, so steady polling doesn't allocate. If it can't
+ * grow it is left empty, and sends fall back as if no node had replied.
+ * @param n the node
+ * @return 0 on success, ARTNET_EMEM if the index couldn't be allocated
  */
-int find_nodes_from_uni(node_list_t *nl, uint8_t uni, SI *ips, int size) {
+int reindex_subscribers(node n) {
+  subscriber_index_t *idx = &n->subscribers;
   node_entry_private_t *tmp;
   int count = 0;
-  int i,j = 0;
+  int i, j;
 
-  for (tmp = nl->first; tmp; tmp = tmp->next) {
-    int added = FALSE;
-    for (i =0; i < tmp->pub.numbports; i++) {
-      if (tmp->pub.swout[i] == uni && ips) {
-        if (j < size && !added) {
-          ips[j++] = tmp->ip;
-          added = TRUE;
-        }
-        count++;
+  for (tmp = n->node_list.first; tmp; tmp = tmp->next)
+    count += min(tmp->pub.numbports, ARTNET_MAX_PORTS);
+
+  if (count > idx->size) {
+    subscriber_t *entries = realloc(idx->entries, sizeof(subscriber_t) * count);
+    if (!entries) {
+      idx->length = 0;
+      artnet_error_malloc();
+      return ARTNET_EMEM;
+    }
+    idx->entries = entries;
+    idx->size = count;
+  }
+
+  idx->length = 0;
+  for (tmp = n->node_list.first; tmp; tmp = tmp->next) {
+    uint16_t net_sub = (tmp->pub.sub & 0x7F00) | ((tmp->pub.sub & 0x0F) << 4);
+    int ports = min(tmp->pub.numbports, ARTNET_MAX_PORTS);
+
+    for (i = 0; i < ports; i++) {
+      if (tmp->pub.porttypes[i] & ARTNET_ENABLE_OUTPUT) {
+        idx->entries[idx->length].addr = net_sub | (tmp->pub.swout[i] & 0x0F);
+        idx->entries[idx->length].ip = tmp->ip;
+        idx->length++;
       }
     }
   }
-  return count;
+
+  qsort(idx->entries, idx->length, sizeof(subscriber_t), compare_subscribers);
+
+  // a node with two outputs on one address is sent to once
+  for (i = 0, j = 0; i < idx->length; i++) {
+    if (j > 0 && !compare_subscribers(&idx->entries[j - 1], &idx->entries[i]))
+      continue;
+    idx->entries[j++] = idx->entries[i];
+  }
+  idx->length = j;
+  return ARTNET_EOK;
+}
+
+
+/*
+ * Find the nodes with an output on a Port-Address
+ * @param n the node
+ * @param address the Port-Address to search for
+ * @param first set to the first matching index entry
+ * @return number of nodes matched, stored from *first on
+ */
+int find_subscribers(node n, uint16_t address, const subscriber_t **first) {
+  const subscriber_t *entries = n->subscribers.entries;
+  int lo = 0, hi = n->subscribers.length, end;
+
+  // lower bound
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (entries[mid].addr < address)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  for (end = lo; end < n->subscribers.length && entries[end].addr == address; end++)
+    ;
+
+  *first = entries + lo;
+  return end - lo;
 }
 
 
@@ -19,6 +19,10 @@
  *
  */
 
+#if defined(HAVE_SENDMMSG) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE // sendmmsg, before any system header
+#endif
+
 #include <errno.h>
 
 #if !defined(WIN32) && !defined(_MSC_VER)
@@ -659,6 +663,30 @@ int artnet_net_send(node n, artnet_packet p) {
   if (n->state.verbose)
     printf("sending to %s\n" , inet_ntoa(addr.sin_addr));
 
+  // inside a batch, queue it for artnet_net_flush; anything bigger than an
+  // ArtDmx goes out now, after what is queued so the order is kept
+  if (n->batch.active) {
+    batch_packet_t *q;
+
+    if (n->batch.count == ARTNET_BATCH_SIZE || p->length > (int) sizeof(q->data)) {
+      if (artnet_net_flush(n))
+        n->batch.failed = TRUE;
+    }
+
+    if (p->length <= (int) sizeof(q->data)) {
+      q = &n->batch.packets[n->batch.count++];
+      q->to = p->to;
+      q->length = p->length;
+      memcpy(q->data, &p->data, p->length);
+
+      if (n->callbacks.send.fh) {
+        get_type(p);
+        n->callbacks.send.fh(n, p, n->callbacks.send.data);
+      }
+      return ARTNET_EOK;
+    }
+  }
+
   ret = sendto(n->sd,
                (char*) &p->data, // char* required for win32
                p->length,
@@ -684,6 +712,89 @@ int artnet_net_send(node n, artnet_packet p) {
 }
 
 
+/*
+ * Send the queued packets: one sendmmsg() call for the whole batch where
+ * available, else a sendto() per packet. A packet that fails is skipped and
+ * the rest are still sent.
+ * @return 0 if every packet was sent, ARTNET_ENET otherwise
+ */
+int artnet_net_flush(node n) {
+  node_batch_t *b = &n->batch;
+  struct sockaddr_in addr[ARTNET_BATCH_SIZE];
+  int i, ret = ARTNET_EOK;
+
+  for (i = 0; i < b->count; i++) {
+    memset(&addr[i], 0x00, sizeof(addr[i]));
+    addr[i].sin_family = AF_INET;
+    addr[i].sin_port = htons(ARTNET_PORT);
+    addr[i].sin_addr = b->packets[i].to;
+  }
+
+#ifdef HAVE_SENDMMSG
+  {
+    struct mmsghdr msgs[ARTNET_BATCH_SIZE];
+    struct iovec iov[ARTNET_BATCH_SIZE];
+    int sent = 0;
+
+    memset(msgs, 0x00, sizeof(struct mmsghdr) * b->count);
+    for (i = 0; i < b->count; i++) {
+      iov[i].iov_base = b->packets[i].data;
+      iov[i].iov_len = b->packets[i].length;
+      msgs[i].msg_hdr.msg_name = &addr[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(addr[i]);
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    while (sent < b->count) {
+      int r = sendmmsg(n->sd, msgs + sent, b->count - sent, 0);
+
+      if (r == -1) {
+        if (errno == EINTR)
+          continue;
+        // the first packet left failed; drop it and carry on with the rest
+        artnet_error("Sendmmsg failed: %s", artnet_net_last_error());
+        n->state.report_code = ARTNET_RCUDPFAIL;
+        ret = ARTNET_ENET;
+        sent++;
+        continue;
+      }
+
+      for (i = sent; i < sent + r; i++) {
+        if (msgs[i].msg_len != (unsigned int) b->packets[i].length) {
+          artnet_error("failed to send full datagram");
+          n->state.report_code = ARTNET_RCSOCKETWR1;
+          ret = ARTNET_ENET;
+        }
+      }
+      sent += r;
+    }
+  }
+#else
+  for (i = 0; i < b->count; i++) {
+    int r = sendto(n->sd,
+                   (char*) b->packets[i].data, // char* required for win32
+                   b->packets[i].length,
+                   0,
+                   (SA*) &addr[i],
+                   sizeof(addr[i]));
+    if (r == -1) {
+      artnet_error("Sendto failed: %s", artnet_net_last_error());
+      n->state.report_code = ARTNET_RCUDPFAIL;
+      ret = ARTNET_ENET;
+    } else if (r != b->packets[i].length) {
+      artnet_error("failed to send full datagram");
+      n->state.report_code = ARTNET_RCSOCKETWR1;
+      ret = ARTNET_ENET;
+    }
+  }
+#endif
+
+  b->count = 0;
+  return ret;
+}
+
+
 /*
 int artnet_net_reprogram(node n) {
   iface_t *ift_head, *ift;
@@ -383,6 +383,7 @@ typedef struct node_entry_private_s {
   SI ip;  // don't rely on the ip address that the node
           // sends, they could be faking it. This is the ip that
           // the pollreply was sent from
+  time_t last_seen; // when the last pollreply arrived, see artnet_nl_expire
 } node_entry_private_t;
 
 /**
@@ -396,6 +397,23 @@ typedef struct {
   int length;
 } node_list_t;
 
+/**
+ * The subscriber index maps a Port-Address to the nodes with an output on
+ * it. Entries are sorted by address (then ip), one per node and address, and
+ * rebuilt whenever the outputs in the node list change, so sending to a
+ * universe neither walks the list nor allocates.
+ */
+typedef struct {
+  uint16_t addr;
+  SI ip;
+} subscriber_t;
+
+typedef struct {
+  subscriber_t *entries;
+  int length;
+  int size;   // allocated entries
+} subscriber_index_t;
+
 
 // End node list structures
 //-----------------------------------------------------------------------------
@@ -441,6 +459,23 @@ typedef struct {
 } node_peering_t;
 
 
+// packets held between artnet_batch_begin() and artnet_batch_flush()
+enum { ARTNET_BATCH_SIZE = 64 };
+
+typedef struct {
+  SI to;
+  int length;
+  uint8_t data[sizeof(artnet_dmx_t)];  // ArtDmx is the largest packet batched
+} batch_packet_t;
+
+typedef struct {
+  int active;
+  int count;
+  int failed;   // a packet flushed early (batch full) failed to send
+  batch_packet_t packets[ARTNET_BATCH_SIZE];
+} node_batch_t;
+
+
 /**
  * The main node structure
  */
@@ -455,8 +490,10 @@ typedef struct artnet_node_s{
   } ports;
   artnet_reply_t ar_temp;       // buffered artpoll reply packet
   node_list_t node_list;        // node list
+  subscriber_index_t subscribers; // Port-Address -> nodes, built from node_list
   firmware_transfer_t firmware; // firmware details
   node_peering_t peering;       // peer if we've joined a group
+  node_batch_t batch;           // queued packets, see artnet_batch_begin
 } artnet_node_t;
 
 
@@ -470,7 +507,7 @@ typedef artnet_node_t *node;
 node_entry_private_t *find_private_entry( node n, artnet_node_entry e);
 void check_timeouts(node n);
 node_entry_private_t *find_entry_from_ip(node_list_t *nl, SI ip);
-int artnet_nl_update(node_list_t *nl, artnet_packet reply);
+int artnet_nl_update(node n, artnet_packet reply);
 
 
 // exported from receive.c
@@ -482,6 +519,7 @@ void reset_firmware_upload(node n);
 // exported from transmit.c
 int artnet_tx_poll(node n, const char *ip,  artnet_ttm_value_t ttm);
 int artnet_tx_poll_reply(node n, int reply);
+int artnet_tx_sync(node n);
 int artnet_tx_tod_data(node n, int id);
 int artnet_tx_firmware_reply(node n, in_addr_t ip, artnet_firmware_status_code code);
 int artnet_tx_firmware_packet(node n, firmware_transfer_t *firm );
@@ -494,6 +532,7 @@ int artnet_tx_build_art_poll_reply(node n);
 // exported from network.c
 int artnet_net_recv(node n, artnet_packet p, int block);
 int artnet_net_send(node n, artnet_packet p);
+int artnet_net_flush(node n);
 int artnet_net_set_non_block(node n);
 int artnet_net_init(node n, const char *ip);
 int artnet_net_start(node n);
@@ -71,7 +71,7 @@ int handle_poll(node n, artnet_packet p) {
  */
 void handle_reply(node n, artnet_packet p) {
   // update the node list
-  artnet_nl_update(&n->node_list, p);
+  artnet_nl_update(n, p);
 
   // run callback if defined
   if (check_callback(n, p, n->callbacks.reply))
@@ -772,6 +772,9 @@ int handle(node n, artnet_packet p) {
     case ARTNET_DMX:
       handle_dmx(n, p);
       break;
+    case ARTNET_SYNC:
+      // only meaningful to output ports latching synchronous data
+      break;
     case ARTNET_ADDRESS:
       handle_address(n, p);
       break;
@@ -59,6 +59,28 @@ int artnet_tx_poll(node n, const char *ip, artnet_ttm_value_t ttm) {
   }
 }
 
+/*
+ * Send an ArtSync. Receivers in synchronous mode hold the ArtDmx data they
+ * have received and output every universe together when this arrives.
+ * Always broadcast.
+ */
+int artnet_tx_sync(node n) {
+  artnet_packet_t p;
+
+  p.to.s_addr = n->state.bcast_addr.s_addr;
+  p.type = ARTNET_SYNC;
+  p.length = sizeof(artnet_sync_t);
+
+  memcpy(&p.data.sync.id, ARTNET_STRING, ARTNET_STRING_SIZE);
+  p.data.sync.opCode = htols(ARTNET_SYNC);
+  p.data.sync.verH = 0;
+  p.data.sync.ver = ARTNET_VERSION;
+  p.data.sync.aux1 = 0;
+  p.data.sync.aux2 = 0;
+
+  return artnet_net_send(n, &p);
+}
+
 /*
  * Send an ArtPollReply
  * @param n the node
@@ -266,6 +266,14 @@ EXTERN int artnet_raw_send_dmx(artnet_node vn,
   uint8_t uni,
   int16_t length,
   const uint8_t *data);
+EXTERN int artnet_send_dmx_addr(artnet_node vn,
+  uint16_t address,
+  uint8_t sequence,
+  int16_t length,
+  const uint8_t *data);
+EXTERN int artnet_send_sync(artnet_node vn);
+EXTERN int artnet_batch_begin(artnet_node vn);
+EXTERN int artnet_batch_flush(artnet_node vn);
 EXTERN int artnet_send_address(artnet_node n,
   artnet_node_entry e,
   const char *shortName,
@@ -336,6 +344,7 @@ EXTERN artnet_node_list artnet_get_nl(artnet_node n);
 EXTERN artnet_node_entry artnet_nl_first(artnet_node_list nl);
 EXTERN artnet_node_entry artnet_nl_next(artnet_node_list nl);
 EXTERN int artnet_nl_get_length(artnet_node_list nl);
+EXTERN int artnet_nl_expire(artnet_node n, int seconds);
 
 // misc
 EXTERN int artnet_dump_config(artnet_node n);
@@ -60,6 +60,11 @@ enum { ARTNET_REPORT_LENGTH = 64 };
  */
 enum { ARTNET_DMX_LENGTH = 512 };
 
+/**
+ * The highest 15 bit Port-Address (Net:SubNet:Universe). Always 32767
+ */
+enum { ARTNET_MAX_PORT_ADDR = 0x7FFF };
+
 /*
  * Number of bytes in a RDM UID
  */
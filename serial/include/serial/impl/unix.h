@@ -83,6 +83,9 @@ public:
   bool
   isOpen () const;
 
+  int
+  getFd () const;
+
   size_t
   available ();
 
@@ -72,6 +72,9 @@ public:
   bool
   isOpen () const;
 
+  int
+  getFd () const;
+
   size_t
   available ();
   
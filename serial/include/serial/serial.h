@@ -211,6 +211,17 @@ public:
   bool
   isOpen () const;
 
+  /*! Gets the native file descriptor of the open port.
+   *
+   * Lets callers drive the port directly (non-blocking writes, ioctl) on
+   * POSIX systems.
+   *
+   * \return The file descriptor, or -1 if the port is closed or the
+   * platform has no file descriptors (Windows).
+   */
+  int
+  getFd () const;
+
   /*! Closes the serial port. */
   void
   close ();
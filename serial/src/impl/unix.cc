@@ -23,6 +23,27 @@
 # include <linux/serial.h>
 #endif
 
+// termios2 (arbitrary baud via BOTHER) for drivers without the legacy custom
+// divisor interface, e.g. ptys and newer USB adapters. <asm/termbits.h> clashes
+// with <termios.h>, so mirror the asm-generic struct that TCGETS2 expects.
+#if defined(__linux__) && defined(TCGETS2) && \
+    (defined(__x86_64__) || defined(__i386__) || defined(__aarch64__) || defined(__arm__) || defined(__riscv))
+# define SERIAL_HAVE_TERMIOS2 1
+# ifndef BOTHER
+#  define BOTHER 0010000
+# endif
+struct termios2 {
+  tcflag_t c_iflag;
+  tcflag_t c_oflag;
+  tcflag_t c_cflag;
+  tcflag_t c_lflag;
+  cc_t c_line;
+  cc_t c_cc[19];
+  speed_t c_ispeed;
+  speed_t c_ospeed;
+};
+#endif
+
 #include <sys/select.h>
 #include <sys/time.h>
 #include <time.h>
@@ -429,19 +450,34 @@ Serial::SerialImpl::reconfigurePort ()
     // Linux Support
 #elif defined(__linux__) && defined (TIOCSSERIAL)
     struct serial_struct ser;
+    bool custom_set = false;
 
-    if (-1 == ioctl (fd_, TIOCGSERIAL, &ser)) {
-      THROW (IOException, errno);
-    }
+    if (-1 != ioctl (fd_, TIOCGSERIAL, &ser)) {
+      // set custom divisor
+      ser.custom_divisor = ser.baud_base / static_cast<int> (baudrate_);
+      // update flags
+      ser.flags &= ~ASYNC_SPD_MASK;
+      ser.flags |= ASYNC_SPD_CUST;
 
-    // set custom divisor
-    ser.custom_divisor = ser.baud_base / static_cast<int> (baudrate_);
-    // update flags
-    ser.flags &= ~ASYNC_SPD_MASK;
-    ser.flags |= ASYNC_SPD_CUST;
+      custom_set = (-1 != ioctl (fd_, TIOCSSERIAL, &ser));
+    }
 
-    if (-1 == ioctl (fd_, TIOCSSERIAL, &ser)) {
+    if (!custom_set) {
+#if defined(SERIAL_HAVE_TERMIOS2)
+      struct termios2 tio2;
+      if (-1 == ioctl (fd_, TCGETS2, &tio2)) {
+        THROW (IOException, errno);
+      }
+      tio2.c_cflag &= ~(CBAUD | (CBAUD << 16));
+      tio2.c_cflag |= BOTHER | (BOTHER << 16);
+      tio2.c_ispeed = static_cast<speed_t> (baudrate_);
+      tio2.c_ospeed = static_cast<speed_t> (baudrate_);
+      if (-1 == ioctl (fd_, TCSETS2, &tio2)) {
+        THROW (IOException, errno);
+      }
+#else
       THROW (IOException, errno);
+#endif
     }
 #else
     throw invalid_argument ("OS does not currently support custom bauds");
@@ -482,6 +518,12 @@ Serial::SerialImpl::isOpen () const
   return is_open_;
 }
 
+int
+Serial::SerialImpl::getFd () const
+{
+  return is_open_ ? fd_ : -1;
+}
+
 size_t
 Serial::SerialImpl::available ()
 {
@@ -299,6 +299,12 @@ Serial::SerialImpl::isOpen () const
   return is_open_;
 }
 
+int
+Serial::SerialImpl::getFd () const
+{
+  return -1;
+}
+
 size_t
 Serial::SerialImpl::available ()
 {
@@ -95,6 +95,12 @@ Serial::isOpen () const
   return pimpl_->isOpen ();
 }
 
+int
+Serial::getFd () const
+{
+  return pimpl_->getFd ();
+}
+
 size_t
 Serial::available ()
 {